@@ -0,0 +1,245 @@
+#include "AssetLoader.h"
+
+#include <chrono>
+
+#include "AssetManager.h"
+#include "Common/CommonUtility.h"
+
+std::unique_ptr<AssetLoader> AssetLoader::singleton = nullptr;
+
+AssetLoader::AssetLoader()
+{
+}
+
+AssetLoader::~AssetLoader()
+{
+	// Don't leave jobs writing into entries nobody will read
+	for (auto& entry : mEntries)
+	{
+		JobSystem::singleton->wait(entry->group);
+	}
+}
+
+void AssetLoader::prefetchTexture(const std::string & filename)
+{
+	if (!CommonUtility::singleton->manager.get<GL::Texture2D>(filename))
+	{
+		request(Kind::Texture, filename);
+	}
+}
+
+void AssetLoader::prefetchAudio(const std::string & filename)
+{
+	if (!CommonUtility::singleton->manager.get<Audio::Buffer>(filename))
+	{
+		request(Kind::Audio, filename);
+	}
+}
+
+void AssetLoader::prefetchScene(const std::string & filename)
+{
+	if (!AssetManager::hasSceneTemplate(filename))
+	{
+		request(Kind::Scene, filename);
+	}
+}
+
+void AssetLoader::update(const Float budget)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	// Upload at least one asset per frame, so that the queue keeps moving
+	bool uploaded = false;
+	for (std::size_t i = 0; i < mEntries.size(); )
+	{
+		if (!JobSystem::singleton->isDone(mEntries[i]->group))
+		{
+			++i;
+			continue;
+		}
+
+		const std::chrono::duration<Float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		if (uploaded && elapsed.count() >= budget)
+		{
+			break;
+		}
+
+		// Loading takes the entry from here, unless the asset was loaded meanwhile
+		const Kind kind = mEntries[i]->kind;
+		const std::string filename = mEntries[i]->filename;
+		switch (kind)
+		{
+		case Kind::Texture:
+			CommonUtility::singleton->loadTexture(filename);
+			break;
+
+		case Kind::Audio:
+			CommonUtility::singleton->loadAudioData(filename);
+			break;
+
+		case Kind::Scene:
+			AssetManager::getSceneTemplate(filename);
+			break;
+		}
+
+		take(kind, filename);
+		uploaded = true;
+	}
+
+	// Slots may have been freed, so start decoding more
+	while (!mRequests.empty() && mEntries.size() < ASSET_LOADER_MAX_IN_FLIGHT)
+	{
+		submit(std::move(mRequests.front()));
+		mRequests.pop_front();
+	}
+}
+
+Containers::Optional<Trade::ImageData2D> AssetLoader::takeImage(const std::string & filename)
+{
+	const std::unique_ptr<Entry> entry = take(Kind::Texture, filename);
+	if (entry == nullptr)
+	{
+		return Containers::NullOpt;
+	}
+	return std::move(entry->image);
+}
+
+Containers::Optional<DecodedAudio> AssetLoader::takeAudio(const std::string & filename)
+{
+	const std::unique_ptr<Entry> entry = take(Kind::Audio, filename);
+	if (entry == nullptr)
+	{
+		return Containers::NullOpt;
+	}
+	return std::move(entry->audio);
+}
+
+std::unique_ptr<DecodedScene> AssetLoader::takeScene(const std::string & filename)
+{
+	const std::unique_ptr<Entry> entry = take(Kind::Scene, filename);
+	if (entry == nullptr || !entry->decoded)
+	{
+		return nullptr;
+	}
+	return std::move(entry->scene);
+}
+
+Containers::Optional<Trade::ImageData2D> AssetLoader::decodeImage(Trade::AbstractImporter & importer, const std::string & filename)
+{
+	if (!CommonUtility::singleton->openAsset(importer, "textures/" + filename + ".png"))
+	{
+		return Containers::NullOpt;
+	}
+	return importer.image2D(0);
+}
+
+Containers::Optional<DecodedAudio> AssetLoader::decodeAudio(Audio::AbstractImporter & importer, const std::string & filename)
+{
+	if (!CommonUtility::singleton->openAsset(importer, "audios/" + filename + ".ogg"))
+	{
+		return Containers::NullOpt;
+	}
+
+	// Keep a copy of the samples, since the importer owns them
+	return DecodedAudio{ importer.format(), importer.data(), importer.frequency() };
+}
+
+void AssetLoader::request(const Kind kind, const std::string & filename)
+{
+	for (const auto& entry : mEntries)
+	{
+		if (entry->kind == kind && entry->filename == filename)
+		{
+			return;
+		}
+	}
+
+	for (const auto& entry : mRequests)
+	{
+		if (entry->kind == kind && entry->filename == filename)
+		{
+			return;
+		}
+	}
+
+	std::unique_ptr<Entry> entry = std::make_unique<Entry>();
+	entry->kind = kind;
+	entry->filename = filename;
+	entry->decoded = false;
+
+	if (mEntries.size() < ASSET_LOADER_MAX_IN_FLIGHT)
+	{
+		submit(std::move(entry));
+	}
+	else
+	{
+		mRequests.push_back(std::move(entry));
+	}
+}
+
+void AssetLoader::submit(std::unique_ptr<Entry> entry)
+{
+	// Entries are only destroyed once their job is done, so jobs can refer to them
+	Entry* e = entry.get();
+	mEntries.push_back(std::move(entry));
+
+	switch (e->kind)
+	{
+	case Kind::Texture:
+		e->imageImporter = mImageImporters.loadAndInstantiate("PngImporter");
+		if (e->imageImporter)
+		{
+			JobSystem::singleton->submit(e->group, [e]() {
+				e->image = decodeImage(*e->imageImporter, e->filename);
+			});
+		}
+		break;
+
+	case Kind::Audio:
+		e->audioImporter = mAudioImporters.loadAndInstantiate("StbVorbisAudioImporter");
+		if (e->audioImporter)
+		{
+			JobSystem::singleton->submit(e->group, [e]() {
+				e->audio = decodeAudio(*e->audioImporter, e->filename);
+			});
+		}
+		break;
+
+	case Kind::Scene:
+		e->scene = std::make_unique<DecodedScene>();
+		if (AssetManager::instantiateImporters(*e->scene, mImageImporters))
+		{
+			JobSystem::singleton->submit(e->group, [e]() {
+				e->decoded = AssetManager::decodeScene(*e->scene, e->filename);
+			});
+		}
+		break;
+	}
+}
+
+std::unique_ptr<AssetLoader::Entry> AssetLoader::take(const Kind kind, const std::string & filename)
+{
+	for (auto it = mEntries.begin(); it != mEntries.end(); ++it)
+	{
+		if ((*it)->kind == kind && (*it)->filename == filename)
+		{
+			// Usually done already, otherwise the main thread helps with queued jobs
+			JobSystem::singleton->wait((*it)->group);
+
+			std::unique_ptr<Entry> entry = std::move(*it);
+			mEntries.erase(it);
+			return entry;
+		}
+	}
+
+	// Not started yet, so it will be loaded as if never requested
+	for (auto it = mRequests.begin(); it != mRequests.end(); ++it)
+	{
+		if ((*it)->kind == kind && (*it)->filename == filename)
+		{
+			mRequests.erase(it);
+			break;
+		}
+	}
+	return nullptr;
+}
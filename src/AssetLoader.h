@@ -0,0 +1,112 @@
+#pragma once
+
+#define ASSET_LOADER_MAX_IN_FLIGHT 8U
+#define ASSET_LOADER_FRAME_BUDGET 2.0f
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Magnum/Magnum.h>
+#include <Magnum/Audio/AbstractImporter.h>
+#include <Magnum/Audio/Buffer.h>
+#include <Magnum/Trade/AbstractImporter.h>
+#include <Magnum/Trade/ImageData.h>
+
+#include "Core/JobSystem.h"
+
+using namespace Magnum;
+
+struct DecodedScene;
+
+// Samples of an audio file, ready for an audio buffer
+struct DecodedAudio
+{
+	Audio::BufferFormat format;
+	Containers::Array<char> data;
+	UnsignedInt frequency;
+};
+
+/*
+	Textures, sounds and scenes decoded on the job system ahead of their first
+	use, so that the game does not stall when an effect shows up for the first
+	time. Decoded assets are uploaded to the GPU by "update", a few per frame
+	within a time budget. Loading an asset which is still in the queue takes
+	it from here, waiting for its decoding if needed, so callers never see a
+	half loaded resource. At most ASSET_LOADER_MAX_IN_FLIGHT assets are being
+	decoded or waiting for upload, to bound the memory held by decoded data.
+	Every method must be called from the main thread.
+*/
+class AssetLoader
+{
+public:
+	static std::unique_ptr<AssetLoader> singleton;
+
+	AssetLoader();
+	~AssetLoader();
+
+	// Start decoding an asset in background, if not already loaded or requested
+	void prefetchTexture(const std::string & filename);
+	void prefetchAudio(const std::string & filename);
+	void prefetchScene(const std::string & filename);
+
+	// Upload decoded assets until the budget (in milliseconds) is over, then start decoding more
+	void update(const Float budget);
+
+	// Decoded asset, waiting for it if requested, or nothing if not requested or failed
+	Containers::Optional<Trade::ImageData2D> takeImage(const std::string & filename);
+	Containers::Optional<DecodedAudio> takeAudio(const std::string & filename);
+	std::unique_ptr<DecodedScene> takeScene(const std::string & filename);
+
+	// Decoding steps, shared with synchronous loading. They can run on any thread
+	static Containers::Optional<Trade::ImageData2D> decodeImage(Trade::AbstractImporter & importer, const std::string & filename);
+	static Containers::Optional<DecodedAudio> decodeAudio(Audio::AbstractImporter & importer, const std::string & filename);
+
+protected:
+	enum class Kind
+	{
+		Texture,
+		Audio,
+		Scene
+	};
+
+	struct Entry
+	{
+		Kind kind;
+		std::string filename;
+		JobSystem::Group group;
+
+		// Importers are instantiated and destroyed here, their job only uses them
+		Containers::Pointer<Trade::AbstractImporter> imageImporter;
+		Containers::Pointer<Audio::AbstractImporter> audioImporter;
+
+		Containers::Optional<Trade::ImageData2D> image;
+		Containers::Optional<DecodedAudio> audio;
+		std::unique_ptr<DecodedScene> scene;
+
+		// Whether the scene could be decoded, as it is built in place
+		bool decoded;
+	};
+
+	void request(const Kind kind, const std::string & filename);
+	void submit(std::unique_ptr<Entry> entry);
+
+	// Remove an entry, waiting for its job, or nullptr if not requested
+	std::unique_ptr<Entry> take(const Kind kind, const std::string & filename);
+
+	/*
+		Plugin managers are not thread-safe, so every importer is instantiated
+		on the main thread, including those of scenes and of their images.
+		Jobs only use them.
+	*/
+	PluginManager::Manager<Trade::AbstractImporter> mImageImporters;
+	PluginManager::Manager<Audio::AbstractImporter> mAudioImporters;
+
+	// Entries being decoded or waiting for upload, then requests waiting for a slot
+	std::vector<std::unique_ptr<Entry>> mEntries;
+	std::deque<std::unique_ptr<Entry>> mRequests;
+};
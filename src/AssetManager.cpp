@@ -1,337 +1,495 @@
-#include "AssetManager.h"
-
-#include <sstream>
-
-#include <Corrade/Utility/DebugStl.h>
-#include <Corrade/Containers/PointerStl.h>
-#include <Magnum/ImageView.h>
-#include <Magnum/PixelFormat.h>
-#include <Magnum/GL/Renderer.h>
-#include <Magnum/GL/TextureFormat.h>
-#include <Magnum/MeshTools/Compile.h>
-#include <Magnum/Trade/ImageData.h>
-#include <Magnum/Trade/MeshData.h>
-#include <Magnum/Trade/MeshObjectData3D.h>
-#include <Magnum/Trade/SceneData.h>
-#include <Magnum/Trade/TextureData.h>
-#include <Magnum/Trade/PhongMaterialData.h>
-#include <Magnum/Shaders/Phong.h>
-
-#include "Common/CommonTypes.h"
-#include "Common/CommonUtility.h"
-#include "Graphics/GameDrawable.h"
-#include "RoomManager.h"
-
-using namespace Magnum::Math::Literals;
-
-AssetManager::AssetManager() : AssetManager(RESOURCE_SHADER_COLORED_PHONG, RESOURCE_SHADER_TEXTURED_PHONG_DIFFUSE, 1)
-{
-}
-
-AssetManager::AssetManager(const std::string & coloredShaderResourceKey, const std::string & texturedShaderResourceKey, const Int lightCount)
-{
-	// Setup colored shader
-	coloredShader = getColoredShader(coloredShaderResourceKey, lightCount);
-
-	// Setup textured shader
-	texturedShader = getTexturedShader(texturedShaderResourceKey, lightCount);
-}
-
-Resource<GL::AbstractShaderProgram, Shaders::Phong> AssetManager::getColoredShader(const std::string & resourceKey, const Int lightCount)
-{
-	Resource<GL::AbstractShaderProgram, Shaders::Phong> resource = CommonUtility::singleton->manager.get<GL::AbstractShaderProgram, Shaders::Phong>(resourceKey);
-	if (!resource)
-	{
-		Shaders::Phong::Flags flags = Shaders::Phong::Flag::ObjectId;
-		std::unique_ptr<Shaders::Phong> shader = std::make_unique<Shaders::Phong>(flags, lightCount);
-		(*shader.get())
-			.setAmbientColor(0x000000ff_rgbaf)
-			.setSpecularColor(0xffffffff_rgbaf)
-			.setShininess(80.0f)
-			.setObjectId(0);
-
-		Containers::Pointer<GL::AbstractShaderProgram> p = std::move((std::unique_ptr<GL::AbstractShaderProgram>&) shader);
-		CommonUtility::singleton->manager.set(resource.key(), std::move(p));
-	}
-	return resource;
-}
-
-Resource<GL::AbstractShaderProgram, Shaders::Phong> AssetManager::getTexturedShader(const std::string & resourceKey, const Int lightCount)
-{
-	Resource<GL::AbstractShaderProgram, Shaders::Phong> resource = CommonUtility::singleton->manager.get<GL::AbstractShaderProgram, Shaders::Phong>(resourceKey);
-	if (!resource)
-	{
-		Shaders::Phong::Flags flags = Shaders::Phong::Flag::AmbientTexture | Shaders::Phong::Flag::DiffuseTexture | Shaders::Phong::Flag::AlphaMask | Shaders::Phong::Flag::ObjectId;
-		std::unique_ptr<Shaders::Phong> shader = std::make_unique<Shaders::Phong>(flags, lightCount);
-		(*shader.get())
-			.setAmbientColor(0x000000ff_rgbaf)
-			.setSpecularColor(0xffffffff_rgbaf)
-			.setShininess(80.0f)
-			.setObjectId(0);
-
-		Containers::Pointer<GL::AbstractShaderProgram> p = std::move((std::unique_ptr<GL::AbstractShaderProgram>&) shader);
-		CommonUtility::singleton->manager.set(resource.key(), std::move(p));
-	}
-	return resource;
-}
-
-void AssetManager::loadAssets(GameObject& gameObject, Object3D& manipulator, const std::string& filename, IDrawCallback* drawCallback)
-{
-	// Load a scene importer plugin
-	PluginManager::Manager<Trade::AbstractImporter> manager;
-	Containers::Pointer<Trade::AbstractImporter> importer = manager.loadAndInstantiate("AnySceneImporter");
-
-	{
-		const std::string fname = CommonUtility::singleton->mConfig.assetDir + filename;
-		Debug{} << "Loading asset" << fname;
-		if (!importer || !importer->openFile(fname))
-		{
-            Fatal{} << "Could not load asset" << fname;
-		}
-	}
-
-	// Create asset container for this file
-	ImportedAssets assets;
-	assets.meshes = Containers::Array<Resource<GL::Mesh>>{ importer->meshCount() };
-	assets.textures = Containers::Array<Resource<GL::Texture2D>>{ importer->textureCount() };
-	assets.materials = Containers::Array<Resource<Trade::AbstractMaterialData>>{ importer->materialCount() };
-
-	// Load all textures. Textures that fail to load will be NullOpt
-	for (UnsignedInt i = 0; i != importer->textureCount(); ++i)
-	{
-		std::ostringstream key;
-		key << "tex_" << filename << "_" << i;
-		assets.textures[i] = { CommonUtility::singleton->manager.get<GL::Texture2D>(key.str()) };
-
-		if (!assets.textures[i])
-		{
-			Debug{} << "Importing texture" << i << importer->textureName(i);
-
-			Containers::Optional<Trade::TextureData> textureData = importer->texture(i);
-			// if (!textureData || textureData->type() != Trade::TextureData::Type::Texture2D)
-			if (!textureData)
-			{
-				Warning{} << "Cannot load texture properties, skipping";
-				continue;
-			}
-
-			Debug{} << "Importing image" << textureData->image() << importer->image2DName(textureData->image());
-
-			Containers::Optional<Trade::ImageData2D> imageData = importer->image2D(textureData->image());
-			GL::TextureFormat format;
-			if (imageData && imageData->format() == PixelFormat::RGB8Unorm)
-			{
-				format = GL::TextureFormat::RGB8;
-			}
-			else if (imageData && imageData->format() == PixelFormat::RGBA8Unorm)
-			{
-				format = GL::TextureFormat::RGBA8;
-			}
-			else
-			{
-				Warning{} << "Cannot load texture image, skipping";
-				continue;
-			}
-
-			/* Configure the texture */
-			GL::Texture2D texture;
-			texture
-				.setMagnificationFilter(textureData->magnificationFilter())
-				.setMinificationFilter(textureData->minificationFilter(), textureData->mipmapFilter())
-				.setWrapping(textureData->wrapping().xy())
-				.setStorage(Math::log2(imageData->size().max()) + 1, format, imageData->size())
-				.setSubImage(0, {}, *imageData)
-				.generateMipmap();
-
-			// Add to resources
-			CommonUtility::singleton->manager.set(assets.textures[i].key(), std::move(texture));
-		}
-	}
-
-	/*
-		Load all materials. Materials that fail to load will be NullOpt. The
-		data will be stored directly in objects later, so save them only
-		temporarily.
-	*/
-	for (UnsignedInt i = 0; i != importer->materialCount(); ++i)
-	{
-		std::ostringstream key;
-		key << "mat_" << filename << "_" << i;
-
-		Resource<Trade::AbstractMaterialData, Trade::PhongMaterialData> amd = CommonUtility::singleton->manager.get<Trade::AbstractMaterialData, Trade::PhongMaterialData>(key.str());
-		assets.materials[i] = (Resource<Trade::AbstractMaterialData>&) amd;
-
-		if (!assets.materials[i])
-		{
-			Debug{} << "Importing material" << i << importer->materialName(i);
-
-			Containers::Pointer<Trade::AbstractMaterialData> materialData = importer->material(i);
-			// if (!materialData || !(materialData->type() != Trade::MaterialType::Phong))
-			if (!materialData)
-			{
-				Warning{} << "Cannot load material, skipping";
-				continue;
-			}
-
-			Trade::PhongMaterialData phongMaterial = std::move(static_cast<Trade::PhongMaterialData&>(*materialData));
-
-			// Add to resources
-			std::unique_ptr<Trade::AbstractMaterialData> material = std::make_unique<Trade::PhongMaterialData>(std::move(phongMaterial));
-			Containers::Pointer<Trade::AbstractMaterialData> p = std::move(material);
-			CommonUtility::singleton->manager.set(assets.materials[i].key(), std::move(p));
-		}
-	}
-
-	// Load all meshes. Meshes that fail to load will be NullOpt.
-	for (UnsignedInt i = 0; i != importer->meshCount(); ++i)
-	{
-		std::ostringstream key;
-		key << "mesh_" << filename << "_" << i;
-		assets.meshes[i] = { CommonUtility::singleton->manager.get<GL::Mesh>(key.str()) };
-
-		if (!assets.meshes[i])
-		{
-			const auto& name = importer->meshName(i);
-			Debug{} << "Importing mesh" << i << name;
-
-			Containers::Optional<Trade::MeshData> meshData = importer->mesh(i);
-			if (!meshData || !meshData->hasAttribute(Trade::MeshAttribute::Normal) || meshData->primitive() != MeshPrimitive::Triangles)
-			{
-				Warning{} << "Cannot load the mesh, skipping";
-				continue;
-			}
-
-			// Compile the mesh
-			GL::Mesh mesh = MeshTools::compile(*meshData);
-			{
-				const auto& p = name.find('_');
-				mesh.setLabel(p != std::string::npos ? name.substr(0, p) : name);
-			}
-
-			// Add to resources
-			CommonUtility::singleton->manager.set(assets.meshes[i].key(), std::move(mesh));
-		}
-	}
-
-	// Load the scene
-	if (importer->defaultScene() != -1)
-	{
-		Debug{} << "Adding default scene" << importer->sceneName(importer->defaultScene());
-
-		Containers::Optional<Trade::SceneData> sceneData = importer->scene(importer->defaultScene());
-		if (!sceneData)
-		{
-			Error{} << "Cannot load scene, exiting";
-			return;
-		}
-
-		// Recursively add all children
-		for (const UnsignedInt & objectId : sceneData->children3D())
-		{
-			processChildrenAssets(gameObject, assets, *importer, manipulator, objectId, drawCallback);
-		}
-
-		// Sort by trasparency
-#if 1 == 2
-		std::sort(gameObject.mDrawables.begin(), gameObject.mDrawables.end(), [](const std::shared_ptr<BaseDrawable>& a, const std::shared_ptr<BaseDrawable>& b) -> bool {
-			if (a->mMesh.state() == ResourceState::Final && CommonUtility::singleton->stringEndsWith(a->mMesh->label(), "VT"))
-			{
-				a->mMesh->setLabel(a->mMesh->label() + "P");
-				return true;
-			}
-			return false;
-		});
-#endif
-	}
-	else if (!assets.meshes.empty() && assets.meshes[0])
-	{
-		auto& drawables = RoomManager::singleton->mGoLayers[gameObject.mParentIndex].drawables;
-		std::shared_ptr<GameDrawable<Shaders::Phong>> cd = std::make_shared<GameDrawable<Shaders::Phong>>(*drawables, coloredShader, assets.meshes[0], 0xffffffff_rgbaf);
-		cd->setParent(&manipulator);
-		cd->setDrawCallback(drawCallback);
-		gameObject.mDrawables.emplace_back(cd);
-	}
-}
-
-void AssetManager::processChildrenAssets(GameObject& gameObject, ImportedAssets& assets, Trade::AbstractImporter& importer, Object3D& parent, UnsignedInt i, IDrawCallback* drawCallback)
-{
-	const std::string name = importer.object3DName(i);
-	{
-		Debug{} << "Importing object" << i << name;
-		if (CommonUtility::singleton->stringEndsWith(name, "_AvoidMe"))
-		{
-			Debug{} << "This object is skipped by request";
-			return;
-		}
-	}
-
-	Containers::Pointer<Trade::ObjectData3D> objectData = importer.object3D(i);
-	if (!objectData)
-	{
-		Error{} << "Cannot import object, skipping";
-		return;
-	}
-
-	// Add the object to the scene and set its transformations
-	auto* objectNode = new Object3D{ &parent };
-	objectNode->setTransformation(objectData->transformation());
-
-	// Add a drawable if the object has a mesh and the mesh is loaded
-	if (objectData->instanceType() == Trade::ObjectInstanceType3D::Mesh && objectData->instance() != -1 && assets.meshes[objectData->instance()])
-	{
-		const Int materialId = static_cast<Trade::MeshObjectData3D*>(objectData.get())->material();
-		auto& drawables = RoomManager::singleton->mGoLayers[gameObject.mParentIndex].drawables;
-
-		// Material not available / not loaded, use a default material
-		if (materialId == -1 || !assets.materials[materialId])
-		{
-			std::shared_ptr<GameDrawable<Shaders::Phong>> cd = std::make_shared<GameDrawable<Shaders::Phong>>(*drawables, coloredShader, assets.meshes[objectData->instance()], 0xffffffff_rgbaf);
-			cd->setParent(objectNode);
-			cd->setDrawCallback(drawCallback);
-			gameObject.mDrawables.emplace_back(cd);
-		}
-		/*
-			Textured material. If the texture failed to load, again just use a
-			default colored material.
-		*/
-		else if (((Trade::PhongMaterialData&) *assets.materials[materialId]).flags() & Trade::PhongMaterialData::Flag::DiffuseTexture)
-		{
-			Resource<GL::Texture2D>& texture = assets.textures[((Trade::PhongMaterialData&) *assets.materials[materialId]).diffuseTexture()];
-			if (texture)
-			{
-				std::shared_ptr<GameDrawable<Shaders::Phong>> td = std::make_shared<GameDrawable<Shaders::Phong>>(*drawables, texturedShader, assets.meshes[objectData->instance()], texture);
-				td->setParent(objectNode);
-				td->setDrawCallback(drawCallback);
-				gameObject.mDrawables.emplace_back(td);
-			}
-			else
-			{
-				std::shared_ptr<GameDrawable<Shaders::Phong>> cd = std::make_shared<GameDrawable<Shaders::Phong>>(*drawables, coloredShader, assets.meshes[objectData->instance()], 0xffffffff_rgbaf);
-				cd->setParent(objectNode);
-				cd->setDrawCallback(drawCallback);
-				gameObject.mDrawables.emplace_back(cd);
-			}
-
-		}
-		// Color-only material
-		else if (assets.meshes[objectData->instance()]->count() > 0)
-		{
-			std::shared_ptr<GameDrawable<Shaders::Phong>> cd = std::make_shared<GameDrawable<Shaders::Phong>>(*drawables, coloredShader, assets.meshes[objectData->instance()], ((Trade::PhongMaterialData&) *assets.materials[materialId]).diffuseColor());
-			cd->setParent(objectNode);
-			cd->setDrawCallback(drawCallback);
-			gameObject.mDrawables.emplace_back(cd);
-		}
-#if DEBUG
-		else
-		{
-			Debug{} << "Found mesh" << objectData->instance() << "(" << &(assets.meshes[objectData->instance()]) << ") without setCount being called on";
-		}
-#endif
-	}
-
-	// Recursively add children
-	for (const auto& id : objectData->children())
-	{
-		processChildrenAssets(gameObject, assets, importer, *objectNode, UnsignedInt(id), drawCallback);
-	}
-}
+#include "AssetManager.h"
+
+#include <cstring>
+#include <sstream>
+#include <nlohmann/json.hpp>
+
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Containers/PointerStl.h>
+#include <Magnum/ImageView.h>
+#include <Magnum/PixelFormat.h>
+#include <Magnum/GL/Renderer.h>
+#include <Magnum/GL/TextureFormat.h>
+#include <Magnum/MeshTools/Compile.h>
+#include <Magnum/Trade/ImageData.h>
+#include <Magnum/Trade/MeshData.h>
+#include <Magnum/Trade/MeshObjectData3D.h>
+#include <Magnum/Trade/SceneData.h>
+#include <Magnum/Trade/TextureData.h>
+#include <Magnum/Trade/PhongMaterialData.h>
+#include <Magnum/Shaders/Phong.h>
+
+#include "AssetLoader.h"
+#include "Common/CommonTypes.h"
+#include "Common/CommonUtility.h"
+#include "Graphics/GameDrawable.h"
+#include "RoomManager.h"
+
+using namespace Magnum::Math::Literals;
+
+std::unordered_map<std::string, SceneTemplate> AssetManager::sSceneTemplates;
+
+AssetManager::AssetManager() : AssetManager(RESOURCE_SHADER_COLORED_PHONG, RESOURCE_SHADER_TEXTURED_PHONG_DIFFUSE, 1)
+{
+}
+
+AssetManager::AssetManager(const std::string & coloredShaderResourceKey, const std::string & texturedShaderResourceKey, const Int lightCount)
+{
+	// Setup colored shader
+	coloredShader = getColoredShader(coloredShaderResourceKey, lightCount);
+
+	// Setup textured shader
+	texturedShader = getTexturedShader(texturedShaderResourceKey, lightCount);
+}
+
+Resource<GL::AbstractShaderProgram, Shaders::Phong> AssetManager::getColoredShader(const std::string & resourceKey, const Int lightCount)
+{
+	Resource<GL::AbstractShaderProgram, Shaders::Phong> resource = CommonUtility::singleton->manager.get<GL::AbstractShaderProgram, Shaders::Phong>(resourceKey);
+	if (!resource)
+	{
+		Shaders::Phong::Flags flags = Shaders::Phong::Flag::ObjectId;
+		std::unique_ptr<Shaders::Phong> shader = std::make_unique<Shaders::Phong>(flags, lightCount);
+		(*shader.get())
+			.setAmbientColor(0x000000ff_rgbaf)
+			.setSpecularColor(0xffffffff_rgbaf)
+			.setShininess(80.0f)
+			.setObjectId(0);
+
+		Containers::Pointer<GL::AbstractShaderProgram> p = std::move((std::unique_ptr<GL::AbstractShaderProgram>&) shader);
+		CommonUtility::singleton->manager.set(resource.key(), std::move(p));
+	}
+	return resource;
+}
+
+Resource<GL::AbstractShaderProgram, Shaders::Phong> AssetManager::getTexturedShader(const std::string & resourceKey, const Int lightCount)
+{
+	Resource<GL::AbstractShaderProgram, Shaders::Phong> resource = CommonUtility::singleton->manager.get<GL::AbstractShaderProgram, Shaders::Phong>(resourceKey);
+	if (!resource)
+	{
+		Shaders::Phong::Flags flags = Shaders::Phong::Flag::AmbientTexture | Shaders::Phong::Flag::DiffuseTexture | Shaders::Phong::Flag::AlphaMask | Shaders::Phong::Flag::ObjectId;
+		std::unique_ptr<Shaders::Phong> shader = std::make_unique<Shaders::Phong>(flags, lightCount);
+		(*shader.get())
+			.setAmbientColor(0x000000ff_rgbaf)
+			.setSpecularColor(0xffffffff_rgbaf)
+			.setShininess(80.0f)
+			.setObjectId(0);
+
+		Containers::Pointer<GL::AbstractShaderProgram> p = std::move((std::unique_ptr<GL::AbstractShaderProgram>&) shader);
+		CommonUtility::singleton->manager.set(resource.key(), std::move(p));
+	}
+	return resource;
+}
+
+void AssetManager::loadAssets(GameObject& gameObject, Object3D& manipulator, const std::string& filename, IDrawCallback* drawCallback)
+{
+	const SceneTemplate& scene = getSceneTemplate(filename);
+
+	// Create the node hierarchy
+	std::vector<Object3D*> nodes;
+	nodes.reserve(scene.nodes.size());
+	for (const auto& node : scene.nodes)
+	{
+		auto* objectNode = new Object3D{ node.parent == -1 ? &manipulator : nodes[node.parent] };
+		objectNode->setTransformation(node.transformation);
+		nodes.push_back(objectNode);
+	}
+
+	// Create the drawables on their nodes
+	auto& drawables = RoomManager::singleton->mGoLayers[gameObject.mParentIndex].drawables;
+	for (const auto& item : scene.drawables)
+	{
+		const Resource<GL::Mesh> mesh = CommonUtility::singleton->manager.get<GL::Mesh>(item.mesh);
+		std::shared_ptr<GameDrawable<Shaders::Phong>> d;
+		if (item.textured)
+		{
+			d = std::make_shared<GameDrawable<Shaders::Phong>>(*drawables, texturedShader, mesh, CommonUtility::singleton->manager.get<GL::Texture2D>(item.texture));
+		}
+		else
+		{
+			d = std::make_shared<GameDrawable<Shaders::Phong>>(*drawables, coloredShader, mesh, item.color);
+		}
+		d->setParent(item.node == -1 ? &manipulator : nodes[item.node]);
+		d->setDrawCallback(drawCallback);
+		gameObject.mDrawables.emplace_back(d);
+	}
+
+	// Sort by trasparency
+#if 1 == 2
+	std::sort(gameObject.mDrawables.begin(), gameObject.mDrawables.end(), [](const std::shared_ptr<BaseDrawable>& a, const std::shared_ptr<BaseDrawable>& b) -> bool {
+		if (a->mMesh.state() == ResourceState::Final && CommonUtility::singleton->stringEndsWith(a->mMesh->label(), "VT"))
+		{
+			a->mMesh->setLabel(a->mMesh->label() + "P");
+			return true;
+		}
+		return false;
+	});
+#endif
+}
+
+const SceneTemplate & AssetManager::getSceneTemplate(const std::string& filename)
+{
+	const auto& it = sSceneTemplates.find(filename);
+	if (it != sSceneTemplates.end())
+	{
+		return it->second;
+	}
+
+	// Decoded in background if prefetched, otherwise right now
+	std::unique_ptr<PluginManager::Manager<Trade::AbstractImporter>> manager;
+	std::unique_ptr<DecodedScene> decoded = AssetLoader::singleton->takeScene(filename);
+	if (decoded == nullptr)
+	{
+		manager = std::make_unique<PluginManager::Manager<Trade::AbstractImporter>>();
+		decoded = std::make_unique<DecodedScene>();
+		if (!instantiateImporters(*decoded, *manager) || !decodeScene(*decoded, filename))
+		{
+            Fatal{} << "Could not load asset" << CommonUtility::singleton->mConfig.assetDir + filename;
+		}
+	}
+
+	uploadScene(*decoded, filename);
+	return sSceneTemplates[filename];
+}
+
+bool AssetManager::hasSceneTemplate(const std::string& filename)
+{
+	return sSceneTemplates.find(filename) != sSceneTemplates.end();
+}
+
+void AssetManager::clearSceneTemplates()
+{
+	sSceneTemplates.clear();
+}
+
+bool AssetManager::instantiateImporters(DecodedScene& decoded, PluginManager::Manager<Trade::AbstractImporter>& manager)
+{
+	// Every scene is a glTF binary, whose images are PNG files
+	decoded.importer = manager.loadAndInstantiate("TinyGltfImporter");
+	decoded.imageImporter = manager.loadAndInstantiate("PngImporter");
+	return decoded.importer && decoded.imageImporter;
+}
+
+bool AssetManager::decodeScene(DecodedScene& decoded, const std::string& filename)
+{
+	// Read loose files here too, since images are taken from the file contents
+	Containers::ArrayView<const char> data = CommonUtility::singleton->getPackedAsset(filename);
+	Containers::Array<char> file;
+	Containers::Pointer<Trade::AbstractImporter>& importer = decoded.importer;
+
+	{
+		const std::string fname = CommonUtility::singleton->mConfig.assetDir + filename;
+		Debug{} << "Loading asset" << fname;
+		if (data.empty())
+		{
+			file = Utility::Directory::read(fname);
+			data = Containers::ArrayView<const char>{ file.data(), file.size() };
+		}
+		if (data.empty() || !importer->openData(data))
+		{
+			return false;
+		}
+	}
+	const std::vector<Containers::ArrayView<const char>> images = getEmbeddedImages(data);
+
+	// Decode all textures. Textures that fail to load will have no image
+	decoded.textures.resize(importer->textureCount());
+	for (UnsignedInt i = 0; i != importer->textureCount(); ++i)
+	{
+		std::ostringstream key;
+		key << "tex_" << filename << "_" << i;
+
+		DecodedScene::Texture& texture = decoded.textures[i];
+		texture.key = ResourceKey(key.str());
+
+		Debug{} << "Importing texture" << i << importer->textureName(i);
+
+		texture.properties = importer->texture(i);
+		// if (!texture.properties || texture.properties->type() != Trade::TextureData::Type::Texture2D)
+		if (!texture.properties)
+		{
+			Warning{} << "Cannot load texture properties, skipping";
+			continue;
+		}
+
+		Debug{} << "Importing image" << texture.properties->image() << importer->image2DName(texture.properties->image());
+
+		Containers::Optional<Trade::ImageData2D> imageData;
+		const UnsignedInt image = texture.properties->image();
+		if (image < images.size() && !images[image].empty() && decoded.imageImporter->openData(images[image]))
+		{
+			imageData = decoded.imageImporter->image2D(0);
+			decoded.imageImporter->close();
+		}
+
+		if (imageData && imageData->format() == PixelFormat::RGB8Unorm)
+		{
+			texture.format = GL::TextureFormat::RGB8;
+		}
+		else if (imageData && imageData->format() == PixelFormat::RGBA8Unorm)
+		{
+			texture.format = GL::TextureFormat::RGBA8;
+		}
+		else
+		{
+			Warning{} << "Cannot load texture image, skipping";
+			continue;
+		}
+
+		texture.image = std::move(imageData);
+	}
+
+	/*
+		Load all materials. Materials that fail to load will be null. They
+		are only needed to build the template, so keep them here.
+	*/
+	std::vector<Containers::Pointer<Trade::AbstractMaterialData>> materials(importer->materialCount());
+	for (UnsignedInt i = 0; i != importer->materialCount(); ++i)
+	{
+		Debug{} << "Importing material" << i << importer->materialName(i);
+
+		materials[i] = importer->material(i);
+		// if (!materials[i] || !(materials[i]->type() != Trade::MaterialType::Phong))
+		if (!materials[i])
+		{
+			Warning{} << "Cannot load material, skipping";
+		}
+	}
+
+	// Decode all meshes. Meshes that fail to load will have no data
+	decoded.meshes.resize(importer->meshCount());
+	for (UnsignedInt i = 0; i != importer->meshCount(); ++i)
+	{
+		std::ostringstream key;
+		key << "mesh_" << filename << "_" << i;
+
+		DecodedScene::Mesh& mesh = decoded.meshes[i];
+		mesh.key = ResourceKey(key.str());
+
+		const auto& name = importer->meshName(i);
+		Debug{} << "Importing mesh" << i << name;
+
+		Containers::Optional<Trade::MeshData> meshData = importer->mesh(i);
+		if (!meshData || !meshData->hasAttribute(Trade::MeshAttribute::Normal) || meshData->primitive() != MeshPrimitive::Triangles)
+		{
+			Warning{} << "Cannot load the mesh, skipping";
+			continue;
+		}
+
+		const auto& p = name.find('_');
+		mesh.label = p != std::string::npos ? name.substr(0, p) : name;
+		mesh.data = std::move(meshData);
+	}
+
+	// Load the scene
+	if (importer->defaultScene() != -1)
+	{
+		Debug{} << "Adding default scene" << importer->sceneName(importer->defaultScene());
+
+		Containers::Optional<Trade::SceneData> sceneData = importer->scene(importer->defaultScene());
+		if (!sceneData)
+		{
+			Error{} << "Cannot load scene, exiting";
+			return true;
+		}
+
+		// Recursively add all children
+		for (const UnsignedInt & objectId : sceneData->children3D())
+		{
+			processChildrenAssets(decoded, materials, -1, objectId);
+		}
+	}
+	else if (!decoded.meshes.empty() && decoded.meshes[0].data)
+	{
+		decoded.scene.drawables.push_back({ -1, false, decoded.meshes[0].key, ResourceKey(), 0xffffffff_rgbaf });
+	}
+
+	return true;
+}
+
+std::vector<Containers::ArrayView<const char>> AssetManager::getEmbeddedImages(const Containers::ArrayView<const char> glb)
+{
+	std::vector<Containers::ArrayView<const char>> images;
+	const auto& readUnsignedInt = [&glb](const std::size_t offset) {
+		UnsignedInt value;
+		std::memcpy(&value, glb.data() + offset, sizeof(value));
+		return value;
+	};
+
+	// Header, then a JSON chunk and a binary one, each with its length and type
+	if (glb.size() < 20 || std::memcmp(glb.data(), "glTF", 4) != 0 || std::memcmp(glb.data() + 16, "JSON", 4) != 0)
+	{
+		return images;
+	}
+
+	const std::size_t jsonLength = readUnsignedInt(12);
+	if (jsonLength > glb.size() - 20)
+	{
+		return images;
+	}
+
+	Containers::ArrayView<const char> bin;
+	const std::size_t binOffset = 20 + jsonLength;
+	if (glb.size() - binOffset >= 8 && std::memcmp(glb.data() + binOffset + 4, "BIN\0", 4) == 0)
+	{
+		const std::size_t binLength = readUnsignedInt(binOffset);
+		if (binLength <= glb.size() - binOffset - 8)
+		{
+			bin = Containers::ArrayView<const char>{ glb.data() + binOffset + 8, binLength };
+		}
+	}
+
+	// Images must refer to a view into the binary chunk
+	const nlohmann::json gltf = nlohmann::json::parse(glb.data() + 20, glb.data() + binOffset, nullptr, false);
+	const auto& list = gltf.find("images");
+	const auto& views = gltf.find("bufferViews");
+	if (list == gltf.end() || views == gltf.end() || !list->is_array() || !views->is_array())
+	{
+		return images;
+	}
+
+	for (const auto& item : *list)
+	{
+		images.emplace_back(nullptr);
+
+		const auto& index = item.find("bufferView");
+		if (index == item.end() || !index->is_number_unsigned() || index->get<std::size_t>() >= views->size())
+		{
+			continue;
+		}
+
+		const auto& view = (*views)[index->get<std::size_t>()];
+		const auto& buffer = view.find("buffer");
+		const auto& offset = view.find("byteOffset");
+		const auto& length = view.find("byteLength");
+		if (buffer == view.end() || *buffer != 0 || length == view.end() || !length->is_number_unsigned() || (offset != view.end() && !offset->is_number_unsigned()))
+		{
+			continue;
+		}
+
+		const std::size_t start = offset != view.end() ? offset->get<std::size_t>() : 0;
+		const std::size_t size = length->get<std::size_t>();
+		if (start <= bin.size() && size <= bin.size() - start)
+		{
+			images.back() = Containers::ArrayView<const char>{ bin.data() + start, size };
+		}
+	}
+	return images;
+}
+
+void AssetManager::uploadScene(DecodedScene& decoded, const std::string& filename)
+{
+	for (const auto& item : decoded.textures)
+	{
+		Resource<GL::Texture2D> resTexture = CommonUtility::singleton->manager.get<GL::Texture2D>(item.key);
+		if (resTexture || !item.image)
+		{
+			continue;
+		}
+
+		/* Configure the texture */
+		GL::Texture2D texture;
+		texture
+			.setMagnificationFilter(item.properties->magnificationFilter())
+			.setMinificationFilter(item.properties->minificationFilter(), item.properties->mipmapFilter())
+			.setWrapping(item.properties->wrapping().xy())
+			.setStorage(Math::log2(item.image->size().max()) + 1, item.format, item.image->size())
+			.setSubImage(0, {}, *item.image)
+			.generateMipmap();
+
+		// Add to resources
+		CommonUtility::singleton->manager.set(resTexture.key(), std::move(texture));
+	}
+
+	for (const auto& item : decoded.meshes)
+	{
+		Resource<GL::Mesh> resMesh = CommonUtility::singleton->manager.get<GL::Mesh>(item.key);
+		if (resMesh || !item.data)
+		{
+			continue;
+		}
+
+		// Compile the mesh
+		GL::Mesh mesh = MeshTools::compile(*item.data);
+		mesh.setLabel(item.label);
+
+		// Add to resources
+		CommonUtility::singleton->manager.set(resMesh.key(), std::move(mesh));
+	}
+
+	sSceneTemplates[filename] = std::move(decoded.scene);
+}
+
+void AssetManager::processChildrenAssets(DecodedScene& decoded, const std::vector<Containers::Pointer<Trade::AbstractMaterialData>>& materials, const Int parent, UnsignedInt i)
+{
+	SceneTemplate& scene = decoded.scene;
+	Trade::AbstractImporter& importer = *decoded.importer;
+
+	const std::string name = importer.object3DName(i);
+	{
+		Debug{} << "Importing object" << i << name;
+		if (CommonUtility::singleton->stringEndsWith(name, "_AvoidMe"))
+		{
+			Debug{} << "This object is skipped by request";
+			return;
+		}
+	}
+
+	Containers::Pointer<Trade::ObjectData3D> objectData = importer.object3D(i);
+	if (!objectData)
+	{
+		Error{} << "Cannot import object, skipping";
+		return;
+	}
+
+	// Add the object to the scene and set its transformations
+	const Int objectNode = Int(scene.nodes.size());
+	scene.nodes.push_back({ parent, objectData->transformation() });
+
+	// Add a drawable if the object has a mesh and the mesh is loaded
+	if (objectData->instanceType() == Trade::ObjectInstanceType3D::Mesh && objectData->instance() != -1 && decoded.meshes[objectData->instance()].data)
+	{
+		const Int materialId = static_cast<Trade::MeshObjectData3D*>(objectData.get())->material();
+		const DecodedScene::Mesh& mesh = decoded.meshes[objectData->instance()];
+
+		// Material not available / not loaded, use a default material
+		if (materialId == -1 || !materials[materialId])
+		{
+			scene.drawables.push_back({ objectNode, false, mesh.key, ResourceKey(), 0xffffffff_rgbaf });
+		}
+		/*
+			Textured material. If the texture failed to load, again just use a
+			default colored material.
+		*/
+		else if (((Trade::PhongMaterialData&) *materials[materialId]).flags() & Trade::PhongMaterialData::Flag::DiffuseTexture)
+		{
+			const DecodedScene::Texture& texture = decoded.textures[((Trade::PhongMaterialData&) *materials[materialId]).diffuseTexture()];
+			if (texture.image)
+			{
+				scene.drawables.push_back({ objectNode, true, mesh.key, texture.key, Color4{ 1.0f } });
+			}
+			else
+			{
+				scene.drawables.push_back({ objectNode, false, mesh.key, ResourceKey(), 0xffffffff_rgbaf });
+			}
+
+		}
+		// Color-only material, for meshes which will draw something once compiled
+		else if ((mesh.data->isIndexed() ? mesh.data->indexCount() : mesh.data->vertexCount()) > 0)
+		{
+			scene.drawables.push_back({ objectNode, false, mesh.key, ResourceKey(), ((Trade::PhongMaterialData&) *materials[materialId]).diffuseColor() });
+		}
+#if DEBUG
+		else
+		{
+			Debug{} << "Found mesh" << objectData->instance() << "without any vertex";
+		}
+#endif
+	}
+
+	// Recursively add children
+	for (const auto& id : objectData->children())
+	{
+		processChildrenAssets(decoded, materials, objectNode, UnsignedInt(id));
+	}
+}
@@ -1,38 +1,121 @@
-#pragma once
-
-#include <memory>
-#include <string>
-#include <Corrade/Containers/Array.h>
-#include <Corrade/Containers/Optional.h>
-#include <Magnum/GL/Mesh.h>
-#include <Magnum/GL/Texture.h>
-#include <Magnum/Trade/AbstractImporter.h>
-
-#include "Common/CommonTypes.h"
-#include "GameObject.h"
-
-using namespace Magnum;
-
-struct ImportedAssets
-{
-	Containers::Array<Resource<GL::Mesh>> meshes;
-	Containers::Array<Resource<GL::Texture2D>> textures;
-	Containers::Array<Resource<Trade::AbstractMaterialData>> materials;
-};
-
-class AssetManager
-{
-public:
-	AssetManager();
-	AssetManager(const std::string & coloredShaderResourceKey, const std::string & texturedShaderResourceKey, const Int lightCount);
-
-	void loadAssets(GameObject& gameObject, Object3D& manipulator, const std::string& filename, IDrawCallback* drawCallback);
-	Resource<GL::AbstractShaderProgram, Shaders::Phong> getColoredShader(const std::string & resourceKey, const Int lightCount);
-	Resource<GL::AbstractShaderProgram, Shaders::Phong> getTexturedShader(const std::string & resourceKey, const Int lightCount);
-
-protected:
-	Resource<GL::AbstractShaderProgram, Shaders::Phong> coloredShader;
-	Resource<GL::AbstractShaderProgram, Shaders::Phong> texturedShader;
-
-	void processChildrenAssets(GameObject& gameObject, ImportedAssets& assets, Trade::AbstractImporter& importer, Object3D& parent, UnsignedInt i, IDrawCallback* drawCallback);
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Magnum/GL/Mesh.h>
+#include <Magnum/GL/Texture.h>
+#include <Magnum/GL/TextureFormat.h>
+#include <Magnum/Trade/AbstractImporter.h>
+#include <Magnum/Trade/ImageData.h>
+#include <Magnum/Trade/MeshData.h>
+#include <Magnum/Trade/TextureData.h>
+
+#include "Common/CommonTypes.h"
+#include "GameObject.h"
+
+using namespace Magnum;
+
+/*
+	Scene of an asset file as parsed once, ready to be instantiated many times.
+	Nodes come parents first, and drawables in the order they were found; both
+	refer to their parent node by index, where -1 is the manipulator itself.
+	Meshes and textures are referenced by key, since they live in the
+	resource manager.
+*/
+struct SceneTemplate
+{
+	struct Node
+	{
+		Int parent;
+		Matrix4 transformation;
+	};
+
+	struct Drawable
+	{
+		Int node;
+		bool textured;
+		ResourceKey mesh;
+		ResourceKey texture;
+		Color4 color;
+	};
+
+	std::vector<Node> nodes;
+	std::vector<Drawable> drawables;
+};
+
+/*
+	Contents of a scene file decoded on the CPU, which may happen on any
+	thread, waiting for meshes and textures to be uploaded on the main thread.
+	Plugin managers are not thread-safe, so importers are instantiated on the
+	main thread, and decoding only uses them. Images embedded in the scene
+	are decoded by an importer of their own, since the scene importer would
+	instantiate one more plugin for every image. Importers live until the
+	upload, as decoded data may refer to them.
+*/
+struct DecodedScene
+{
+	struct Texture
+	{
+		ResourceKey key;
+		Containers::Optional<Trade::TextureData> properties;
+		Containers::Optional<Trade::ImageData2D> image;
+		GL::TextureFormat format;
+	};
+
+	struct Mesh
+	{
+		ResourceKey key;
+		Containers::Optional<Trade::MeshData> data;
+		std::string label;
+	};
+
+	Containers::Pointer<Trade::AbstractImporter> importer;
+	Containers::Pointer<Trade::AbstractImporter> imageImporter;
+
+	std::vector<Texture> textures;
+	std::vector<Mesh> meshes;
+	SceneTemplate scene;
+};
+
+class AssetManager
+{
+public:
+	AssetManager();
+	AssetManager(const std::string & coloredShaderResourceKey, const std::string & texturedShaderResourceKey, const Int lightCount);
+
+	void loadAssets(GameObject& gameObject, Object3D& manipulator, const std::string& filename, IDrawCallback* drawCallback);
+	Resource<GL::AbstractShaderProgram, Shaders::Phong> getColoredShader(const std::string & resourceKey, const Int lightCount);
+	Resource<GL::AbstractShaderProgram, Shaders::Phong> getTexturedShader(const std::string & resourceKey, const Int lightCount);
+
+	// Template of the file, decoding it now if it was not prefetched
+	static const SceneTemplate & getSceneTemplate(const std::string& filename);
+	static bool hasSceneTemplate(const std::string& filename);
+
+	// Forget every template, when the resources they refer to are cleared
+	static void clearSceneTemplates();
+
+	// Instantiate the importers of a scene, on the main thread
+	static bool instantiateImporters(DecodedScene& decoded, PluginManager::Manager<Trade::AbstractImporter>& manager);
+
+	// Decode a scene file from any thread, once its importers are instantiated
+	static bool decodeScene(DecodedScene& decoded, const std::string& filename);
+
+protected:
+	Resource<GL::AbstractShaderProgram, Shaders::Phong> coloredShader;
+	Resource<GL::AbstractShaderProgram, Shaders::Phong> texturedShader;
+
+	// Templates of the files loaded so far, by file name
+	static std::unordered_map<std::string, SceneTemplate> sSceneTemplates;
+
+	// Contents of every image embedded in a glTF binary, by index, with an empty view for those not found
+	static std::vector<Containers::ArrayView<const char>> getEmbeddedImages(const Containers::ArrayView<const char> glb);
+
+	static void uploadScene(DecodedScene& decoded, const std::string& filename);
+	static void processChildrenAssets(DecodedScene& decoded, const std::vector<Containers::Pointer<Trade::AbstractMaterialData>>& materials, const Int parent, UnsignedInt i);
 };
\ No newline at end of file
@@ -1,10 +1,10 @@
-#pragma once
-
-#include "../Shaders/SpriteShader.h"
-
-struct SpriteShaderDataView
-{
-	SpriteShader* shader;
-	SpriteShader::Parameters parameters;
-	Float speed;
+#pragma once
+
+#include "../Shaders/SpriteShader.h"
+
+struct SpriteShaderDataView
+{
+	SpriteShader* shader;
+	SpriteShader::Parameters parameters;
+	Float speed;
 };
\ No newline at end of file
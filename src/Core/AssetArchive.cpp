@@ -0,0 +1,308 @@
+#include "AssetArchive.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	template <typename T>
+	void write(std::vector<char> & out, const T value)
+	{
+		const char* p = reinterpret_cast<const char*>(&value);
+		out.insert(out.end(), p, p + sizeof(T));
+	}
+
+	template <typename T>
+	bool read(const char* data, const std::size_t size, std::size_t & position, T & value)
+	{
+		if (size - position < sizeof(T))
+		{
+			return false;
+		}
+		std::memcpy(&value, data + position, sizeof(T));
+		position += sizeof(T);
+		return true;
+	}
+
+	std::size_t align(const std::size_t value)
+	{
+		return (value + ASSET_ARCHIVE_ALIGNMENT - 1U) / ASSET_ARCHIVE_ALIGNMENT * ASSET_ARCHIVE_ALIGNMENT;
+	}
+}
+
+bool AssetArchive::pack(const std::string & root, const std::vector<std::string> & names, const std::string & filename)
+{
+	// Read all files first, since the table needs their sizes
+	std::vector<std::vector<char>> contents;
+	contents.reserve(names.size());
+	for (const auto& name : names)
+	{
+		std::ifstream in(root + name, std::ios::binary);
+		if (!in)
+		{
+			return false;
+		}
+		contents.emplace_back(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	}
+
+	// Size of the header, to know where data starts
+	std::size_t position = ASSET_ARCHIVE_MAGIC_SIZE + 2U * sizeof(std::uint32_t);
+	for (const auto& name : names)
+	{
+		position += 2U * sizeof(std::uint64_t) + sizeof(std::uint32_t) + name.size();
+	}
+	const std::uint32_t tableSize = std::uint32_t(position - ASSET_ARCHIVE_MAGIC_SIZE - 2U * sizeof(std::uint32_t));
+
+	std::vector<char> header(ASSET_ARCHIVE_MAGIC, ASSET_ARCHIVE_MAGIC + ASSET_ARCHIVE_MAGIC_SIZE);
+	write(header, std::uint32_t(names.size()));
+	write(header, tableSize);
+
+	std::vector<std::uint64_t> offsets;
+	for (std::size_t i = 0; i < names.size(); ++i)
+	{
+		position = align(position);
+		offsets.push_back(position);
+
+		write(header, std::uint64_t(position));
+		write(header, std::uint64_t(contents[i].size()));
+		write(header, std::uint32_t(names[i].size()));
+		header.insert(header.end(), names[i].begin(), names[i].end());
+
+		position += contents[i].size();
+	}
+
+	// Write header and data, padding every entry to its offset
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	if (!out)
+	{
+		return false;
+	}
+
+	out.write(header.data(), std::streamsize(header.size()));
+	std::size_t written = header.size();
+	for (std::size_t i = 0; i < names.size(); ++i)
+	{
+		const std::vector<char> padding(std::size_t(offsets[i]) - written, 0);
+		out.write(padding.data(), std::streamsize(padding.size()));
+		out.write(contents[i].data(), std::streamsize(contents[i].size()));
+		written = std::size_t(offsets[i]) + contents[i].size();
+	}
+
+	return bool(out);
+}
+
+#ifdef _WIN32
+
+AssetArchive::AssetArchive() : mData(nullptr), mSize(0), mFile(INVALID_HANDLE_VALUE), mMapping(nullptr)
+{
+}
+
+bool AssetArchive::open(const std::string & filename)
+{
+	close();
+
+	mFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (mFile == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(mFile, &size) || size.QuadPart == 0)
+	{
+		close();
+		return false;
+	}
+
+	mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	mData = mMapping != nullptr ? static_cast<const char*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+	mSize = std::size_t(size.QuadPart);
+
+	if (mData == nullptr || !readTableOfContents())
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+void AssetArchive::close()
+{
+	if (mData != nullptr)
+	{
+		UnmapViewOfFile(mData);
+	}
+	if (mMapping != nullptr)
+	{
+		CloseHandle(mMapping);
+	}
+	if (mFile != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(mFile);
+	}
+
+	mData = nullptr;
+	mSize = 0;
+	mFile = INVALID_HANDLE_VALUE;
+	mMapping = nullptr;
+	mEntries.clear();
+}
+
+#else
+
+AssetArchive::AssetArchive() : mData(nullptr), mSize(0), mFile(-1)
+{
+}
+
+bool AssetArchive::open(const std::string & filename)
+{
+	close();
+
+	mFile = ::open(filename.c_str(), O_RDONLY);
+	if (mFile == -1)
+	{
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(mFile, &info) != 0 || info.st_size == 0)
+	{
+		close();
+		return false;
+	}
+
+	void* data = mmap(nullptr, std::size_t(info.st_size), PROT_READ, MAP_PRIVATE, mFile, 0);
+	if (data == MAP_FAILED)
+	{
+		close();
+		return false;
+	}
+
+	mData = static_cast<const char*>(data);
+	mSize = std::size_t(info.st_size);
+
+	if (!readTableOfContents())
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+void AssetArchive::close()
+{
+	if (mData != nullptr)
+	{
+		munmap(const_cast<char*>(mData), mSize);
+	}
+	if (mFile != -1)
+	{
+		::close(mFile);
+	}
+
+	mData = nullptr;
+	mSize = 0;
+	mFile = -1;
+	mEntries.clear();
+}
+
+#endif
+
+AssetArchive::~AssetArchive()
+{
+	close();
+}
+
+bool AssetArchive::isOpen() const
+{
+	return mData != nullptr;
+}
+
+std::size_t AssetArchive::getEntryCount() const
+{
+	return mEntries.size();
+}
+
+std::vector<std::string> AssetArchive::getNames() const
+{
+	std::vector<std::string> names;
+	names.reserve(mEntries.size());
+	for (const auto& it : mEntries)
+	{
+		names.push_back(it.first);
+	}
+	std::sort(names.begin(), names.end());
+	return names;
+}
+
+AssetArchiveView AssetArchive::find(const std::string & name) const
+{
+	const auto& it = mEntries.find(name);
+	if (it == mEntries.end())
+	{
+		return AssetArchiveView{ nullptr, 0 };
+	}
+	return AssetArchiveView{ mData + it->second.offset, std::size_t(it->second.size) };
+}
+
+bool AssetArchive::readTableOfContents()
+{
+	if (mSize < ASSET_ARCHIVE_MAGIC_SIZE || std::memcmp(mData, ASSET_ARCHIVE_MAGIC, ASSET_ARCHIVE_MAGIC_SIZE) != 0)
+	{
+		return false;
+	}
+
+	std::size_t position = ASSET_ARCHIVE_MAGIC_SIZE;
+	std::uint32_t count, tableSize;
+	if (!read(mData, mSize, position, count) || !read(mData, mSize, position, tableSize) || mSize - position < tableSize)
+	{
+		return false;
+	}
+
+	// A corrupt count must not make the table reserve more entries than it can hold
+	if (count > tableSize / ASSET_ARCHIVE_ENTRY_MIN_SIZE)
+	{
+		return false;
+	}
+
+	// Every entry must lie within the table and its data within the file, so views never have to be checked
+	const std::size_t tableEnd = position + tableSize;
+	mEntries.reserve(count);
+	for (std::uint32_t i = 0; i < count; ++i)
+	{
+		Entry entry;
+		std::uint32_t length;
+		if (!read(mData, tableEnd, position, entry.offset) || !read(mData, tableEnd, position, entry.size) || !read(mData, tableEnd, position, length))
+		{
+			return false;
+		}
+		if (tableEnd - position < length || entry.offset > mSize || entry.size > mSize - entry.offset)
+		{
+			return false;
+		}
+
+		mEntries[std::string(mData + position, length)] = entry;
+		position += length;
+	}
+
+	// The table must hold these entries and nothing else
+	if (position != tableEnd)
+	{
+		return false;
+	}
+
+	return true;
+}
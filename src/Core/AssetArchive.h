@@ -0,0 +1,83 @@
+#pragma once
+
+#define ASSET_ARCHIVE_MAGIC "BMCPAK1"
+#define ASSET_ARCHIVE_MAGIC_SIZE 8
+#define ASSET_ARCHIVE_ALIGNMENT 16
+#define ASSET_ARCHIVE_FILENAME "assets.pak"
+
+// Offset, size and name length of an entry in the table of contents, without its name
+#define ASSET_ARCHIVE_ENTRY_MIN_SIZE 20
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+	Single read-only file holding many assets, addressed by their path
+	relative to the asset directory (e.g.: "textures/bubble_red.png"). The
+	archive is memory-mapped, so assets are handed out as views into it,
+	without reading or copying them. Layout, in native byte order:
+
+	- magic, then entry count and table size as 32-bit integers
+	- table of contents: for every entry its offset and size as 64-bit
+	  integers, then its name length as 32-bit integer and the name
+	- data of every entry, aligned to ASSET_ARCHIVE_ALIGNMENT bytes
+*/
+
+// Contents of an entry, valid while its archive is open
+struct AssetArchiveView
+{
+	const char* data;
+	std::size_t size;
+
+	bool empty() const
+	{
+		return data == nullptr;
+	}
+};
+
+class AssetArchive
+{
+public:
+	// Write an archive with the given files, as found in the root directory
+	static bool pack(const std::string & root, const std::vector<std::string> & names, const std::string & filename);
+
+	AssetArchive();
+	~AssetArchive();
+
+	AssetArchive(const AssetArchive &) = delete;
+	AssetArchive & operator=(const AssetArchive &) = delete;
+
+	bool open(const std::string & filename);
+	void close();
+
+	bool isOpen() const;
+	std::size_t getEntryCount() const;
+
+	// Names of all the entries, sorted
+	std::vector<std::string> getNames() const;
+
+	// Contents of the named entry, or an empty view if not in the archive
+	AssetArchiveView find(const std::string & name) const;
+
+protected:
+	struct Entry
+	{
+		std::uint64_t offset;
+		std::uint64_t size;
+	};
+
+	bool readTableOfContents();
+
+	const char* mData;
+	std::size_t mSize;
+	std::unordered_map<std::string, Entry> mEntries;
+
+#ifdef _WIN32
+	void* mFile;
+	void* mMapping;
+#else
+	int mFile;
+#endif
+};
@@ -0,0 +1,159 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "AssetArchive.h"
+
+// Files packed by the test, written to the working directory
+#define ASSET_ARCHIVE_TEST_PREFIX "AssetArchiveTest_"
+#define ASSET_ARCHIVE_TEST_FILENAME "AssetArchiveTest.pak"
+
+// Offsets in the archive of the entry count, the table size, and the first entry
+#define ASSET_ARCHIVE_TEST_COUNT ASSET_ARCHIVE_MAGIC_SIZE
+#define ASSET_ARCHIVE_TEST_TABLE_SIZE (ASSET_ARCHIVE_MAGIC_SIZE + 4)
+#define ASSET_ARCHIVE_TEST_TABLE (ASSET_ARCHIVE_MAGIC_SIZE + 8)
+
+/*
+	Check that an archive reads back what was packed, and that archives with
+	a corrupt header are refused when opened: an entry count too large for
+	the table, which must not be reserved, a table with bytes left over or
+	missing, and entries or names past their bounds.
+	Usage: BreakMyCircleAssetArchiveTest
+*/
+
+static std::int32_t sFailures = 0;
+
+static void check(const bool condition, const char* what)
+{
+	if (!condition)
+	{
+		std::printf("Failed: %s\n", what);
+		++sFailures;
+	}
+}
+
+static void writeFile(const std::string & filename, const std::vector<char> & content)
+{
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	out.write(content.data(), std::streamsize(content.size()));
+}
+
+static std::vector<char> readFile(const std::string & filename)
+{
+	std::ifstream in(filename, std::ios::binary);
+	return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+template <typename T>
+static void patch(std::vector<char> & data, const std::size_t position, const T value)
+{
+	std::memcpy(data.data() + position, &value, sizeof(T));
+}
+
+template <typename T>
+static T peek(const std::vector<char> & data, const std::size_t position)
+{
+	T value;
+	std::memcpy(&value, data.data() + position, sizeof(T));
+	return value;
+}
+
+// Whether an archive made of the given bytes opens
+static bool openChanged(const std::vector<char> & data)
+{
+	writeFile(ASSET_ARCHIVE_TEST_FILENAME, data);
+	AssetArchive archive;
+	const bool opened = archive.open(ASSET_ARCHIVE_TEST_FILENAME);
+	check(opened == archive.isOpen() && (opened || archive.getEntryCount() == 0U), "failed open leaves the archive closed and empty");
+	return opened;
+}
+
+int main()
+{
+	const std::vector<std::string> names = { ASSET_ARCHIVE_TEST_PREFIX "a.txt", ASSET_ARCHIVE_TEST_PREFIX "b.bin", ASSET_ARCHIVE_TEST_PREFIX "empty" };
+	const std::vector<std::vector<char>> contents = { { 'h', 'e', 'l', 'l', 'o' }, std::vector<char>(100, '\x7f'), {} };
+	for (std::size_t i = 0; i < names.size(); ++i)
+	{
+		writeFile(names[i], contents[i]);
+	}
+
+	// Packed contents read back as they were
+	check(AssetArchive::pack("", names, ASSET_ARCHIVE_TEST_FILENAME), "archive is packed");
+	{
+		AssetArchive archive;
+		check(archive.open(ASSET_ARCHIVE_TEST_FILENAME) && archive.getEntryCount() == names.size(), "archive opens with every entry");
+		for (std::size_t i = 0; i < names.size(); ++i)
+		{
+			const AssetArchiveView view = archive.find(names[i]);
+			check(!view.empty() && view.size == contents[i].size() && std::memcmp(view.data, contents[i].data(), view.size) == 0, "entry reads back");
+		}
+		check(archive.find("missing").empty(), "missing entry is empty");
+	}
+
+	const std::vector<char> packed = readFile(ASSET_ARCHIVE_TEST_FILENAME);
+	const std::uint32_t count = peek<std::uint32_t>(packed, ASSET_ARCHIVE_TEST_COUNT);
+	const std::uint32_t tableSize = peek<std::uint32_t>(packed, ASSET_ARCHIVE_TEST_TABLE_SIZE);
+	check(openChanged(packed), "untouched archive opens");
+
+	// Counts which the table can't hold, up to the largest, are refused before anything is reserved
+	for (const std::uint32_t corrupt : { tableSize / ASSET_ARCHIVE_ENTRY_MIN_SIZE + 1U, 0x00ffffffU, 0xffffffffU })
+	{
+		std::vector<char> data = packed;
+		patch(data, ASSET_ARCHIVE_TEST_COUNT, corrupt);
+		check(!openChanged(data), "count too large for the table is refused");
+	}
+
+	// One entry more reads past the table, one less leaves bytes over
+	{
+		std::vector<char> data = packed;
+		patch(data, ASSET_ARCHIVE_TEST_COUNT, count + 1U);
+		check(!openChanged(data), "entry past the table is refused");
+
+		patch(data, ASSET_ARCHIVE_TEST_COUNT, count - 1U);
+		check(!openChanged(data), "table with bytes left over is refused");
+
+		patch(data, ASSET_ARCHIVE_TEST_COUNT, 0U);
+		check(!openChanged(data), "empty table with a size is refused");
+	}
+
+	// Table sizes off by one, and past the file
+	for (const std::uint32_t corrupt : { tableSize - 1U, tableSize + 1U, std::uint32_t(packed.size()) })
+	{
+		std::vector<char> data = packed;
+		patch(data, ASSET_ARCHIVE_TEST_TABLE_SIZE, corrupt);
+		check(!openChanged(data), "wrong table size is refused");
+	}
+
+	// First entry with its data past the end of the file, or its name past the table
+	{
+		std::vector<char> data = packed;
+		patch(data, ASSET_ARCHIVE_TEST_TABLE + 8U, std::uint64_t(packed.size()));
+		check(!openChanged(data), "entry data past the file is refused");
+
+		data = packed;
+		patch(data, ASSET_ARCHIVE_TEST_TABLE + 16U, tableSize);
+		check(!openChanged(data), "entry name past the table is refused");
+	}
+
+	// Truncated header and wrong magic
+	check(!openChanged(std::vector<char>(packed.begin(), packed.begin() + ASSET_ARCHIVE_TEST_TABLE)), "truncated header is refused");
+	{
+		std::vector<char> data = packed;
+		data[0] = 'X';
+		check(!openChanged(data), "wrong magic is refused");
+	}
+
+	for (const auto& name : names)
+	{
+		std::remove(name.c_str());
+	}
+	std::remove(ASSET_ARCHIVE_TEST_FILENAME);
+
+	std::printf("%d failures\n", sFailures);
+	return sFailures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "AssetArchive.h"
+
+/*
+	Pack the assets loaded by the game into a single archive. Shaders and
+	music are left out, since they are compiled from source and streamed
+	respectively. BreakMyCircleStartupBenchmark compares loading from the
+	archive with loading loose files.
+	Usage: BreakMyCircleAssetPacker <asset dir> [output]
+*/
+
+static const char* ASSET_PACKER_DIRECTORIES[] = { "scenes", "textures", "audios", "fonts", "rooms", "paths" };
+
+// Streamed from file while playing, so never read from the archive
+static const char* ASSET_PACKER_EXCLUDED[] = { "audios/bgmusic.ogg" };
+
+static std::vector<std::string> listFiles(const std::string & root, const std::string & directory)
+{
+	std::vector<std::string> names;
+	std::error_code error;
+	for (const auto& item : std::filesystem::directory_iterator(root + directory, error))
+	{
+		const std::string filename = item.path().filename().string();
+		if (filename[0] != '.' && item.is_regular_file())
+		{
+			names.push_back(directory + "/" + filename);
+		}
+	}
+
+	// Same archive for the same files, whatever the file system order
+	std::sort(names.begin(), names.end());
+	return names;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::printf("Usage: %s <asset dir> [output]\n", argv[0]);
+		return 1;
+	}
+
+	std::string root = argv[1];
+	if (!root.empty() && root.back() != '/')
+	{
+		root += '/';
+	}
+	const std::string output = argc > 2 ? argv[2] : root + ASSET_ARCHIVE_FILENAME;
+
+	std::vector<std::string> names;
+	for (const char* directory : ASSET_PACKER_DIRECTORIES)
+	{
+		for (const auto& name : listFiles(root, directory))
+		{
+			if (std::find(std::begin(ASSET_PACKER_EXCLUDED), std::end(ASSET_PACKER_EXCLUDED), name) == std::end(ASSET_PACKER_EXCLUDED))
+			{
+				names.push_back(name);
+			}
+		}
+	}
+
+	if (!AssetArchive::pack(root, names, output))
+	{
+		std::printf("Could not write %s\n", output.c_str());
+		return 1;
+	}
+	std::printf("Packed %zu assets into %s\n", names.size(), output.c_str());
+	return 0;
+}
@@ -0,0 +1,399 @@
+#include "Board.h"
+
+#include <algorithm>
+#include <cmath>
+
+BoardCell Board::getCellByPosition(const float x, const float y)
+{
+	const std::int32_t row = std::int32_t(std::round(-y * 0.5f));
+	const float offset = row % 2 ? 2.0f : 1.0f;
+	return { row, std::int32_t(std::round((x - offset) * 0.5f)) };
+}
+
+void Board::getPositionByCell(const BoardCell & cell, float & x, float & y)
+{
+	const float offset = cell.row % 2 ? 2.0f : 1.0f;
+	x = offset + float(cell.column) * 2.0f;
+	y = float(cell.row) * -2.0f;
+}
+
+Board::Board(const std::int32_t columns) : mColumns(columns), mStride(columns + 2), mPlayableCount(0), mLowestRow(-1), mEpoch(0), mFirstEpoch(0)
+{
+}
+
+const std::int32_t Board::getColumns() const
+{
+	return mColumns;
+}
+
+const std::int32_t Board::getRows() const
+{
+	return std::int32_t(mCells.size()) / mStride;
+}
+
+bool Board::isInside(const BoardCell & cell) const
+{
+	return cell.row >= 0 && cell.column >= -1 && cell.column <= mColumns;
+}
+
+const BoardPiece* Board::get(const BoardCell & cell) const
+{
+	if (!isInside(cell))
+	{
+		return nullptr;
+	}
+
+	const std::size_t index = getIndex(cell);
+	return index < mCells.size() && mCells[index].kind != BubbleKind::None ? &mCells[index] : nullptr;
+}
+
+BoardPiece* Board::get(const BoardCell & cell)
+{
+	return const_cast<BoardPiece*>(static_cast<const Board*>(this)->get(cell));
+}
+
+void Board::place(const BoardCell & cell, const BoardPiece & piece)
+{
+	if (!isInside(cell))
+	{
+		return;
+	}
+
+	// Rows are allocated lazily, since pieces can be attached down to the limit line
+	const std::size_t index = getIndex(cell);
+	if (index >= mCells.size())
+	{
+		mCells.resize(std::size_t(cell.row + 1) * std::size_t(mStride), BoardPiece{ BubbleKind::None, 0U, 0.0f, 0U });
+	}
+
+	count(mCells[index], -1);
+	count(piece, 1);
+	occupy(cell.row, (piece.kind != BubbleKind::None ? 1 : 0) - (mCells[index].kind != BubbleKind::None ? 1 : 0));
+	mCells[index] = piece;
+}
+
+bool Board::remove(const BoardCell & cell)
+{
+	BoardPiece* piece = get(cell);
+	if (piece == nullptr)
+	{
+		return false;
+	}
+
+	count(*piece, -1);
+	occupy(cell.row, -1);
+	piece->kind = BubbleKind::None;
+	mRemoved.push_back(cell);
+	return true;
+}
+
+void Board::recolor(const BoardCell & cell, const std::uint32_t color)
+{
+	BoardPiece* piece = get(cell);
+	if (piece == nullptr)
+	{
+		return;
+	}
+
+	count(*piece, -1);
+	piece->color = color;
+	count(*piece, 1);
+}
+
+void Board::clear()
+{
+	mCells.clear();
+	mColorCounts.clear();
+	mPlayableCount = 0;
+	mRowCounts.clear();
+	mLowestRow = -1;
+	mRemoved.clear();
+	mVisited.clear();
+}
+
+const std::array<BoardCell, BOARD_NEIGHBOURS> Board::getNeighbours(const BoardCell & cell) const
+{
+	// Adjacent rows are shifted left on even rows, and right on odd ones
+	const std::int32_t s = cell.row % 2 ? 0 : -1;
+	return {
+		BoardCell{ cell.row, cell.column - 1 },
+		BoardCell{ cell.row, cell.column + 1 },
+		BoardCell{ cell.row - 1, cell.column + s },
+		BoardCell{ cell.row - 1, cell.column + s + 1 },
+		BoardCell{ cell.row + 1, cell.column + s },
+		BoardCell{ cell.row + 1, cell.column + s + 1 }
+	};
+}
+
+const std::size_t Board::getIndex(const BoardCell & cell) const
+{
+	return std::size_t(cell.row) * std::size_t(mStride) + std::size_t(cell.column + 1);
+}
+
+const std::size_t Board::getCapacity() const
+{
+	return mCells.size();
+}
+
+void Board::collectMatches(const BoardCell & cell, std::vector<BoardCell> & matches)
+{
+	const BoardPiece* origin = get(cell);
+	if (origin == nullptr)
+	{
+		return;
+	}
+
+	// Flood-fill through same-colored neighbours, without recursion
+	const std::uint32_t color = origin->color;
+	startEpoch();
+
+	const std::size_t first = matches.size();
+	matches.push_back(cell);
+	mVisited[getIndex(cell)] = mEpoch;
+
+	for (std::size_t i = first; i < matches.size(); ++i)
+	{
+		for (const auto& n : getNeighbours(matches[i]))
+		{
+			const BoardPiece* piece = get(n);
+			if (piece == nullptr || piece->color != color)
+			{
+				continue;
+			}
+
+			std::uint32_t& visited = mVisited[getIndex(n)];
+			if (visited != mEpoch)
+			{
+				visited = mEpoch;
+				matches.push_back(n);
+			}
+		}
+	}
+}
+
+void Board::collectOrphans(std::vector<BoardEntry> & orphans)
+{
+	if (mRemoved.empty())
+	{
+		return;
+	}
+
+	// Every search below starts an epoch of its own
+	startEpoch();
+	mFirstEpoch = mEpoch;
+
+	// Only the neighbours of the removed cells may have lost their support
+	for (const auto& removed : mRemoved)
+	{
+		for (const auto& n : getNeighbours(removed))
+		{
+			if (get(n) == nullptr || mVisited[getIndex(n)] >= mFirstEpoch)
+			{
+				continue;
+			}
+
+			if (!isAttachedToCeiling(n, mComponent))
+			{
+				// Unlink the whole component without recording it as removed
+				for (const auto& cell : mComponent)
+				{
+					BoardPiece& piece = mCells[getIndex(cell)];
+					orphans.push_back({ cell, piece });
+					count(piece, -1);
+					occupy(cell.row, -1);
+					piece.kind = BubbleKind::None;
+				}
+			}
+		}
+	}
+
+	mRemoved.clear();
+}
+
+void Board::collectInRadius(const float x, const float y, const float radius, std::vector<BoardCell> & cells) const
+{
+	const std::int32_t rowLow = std::max(0, std::int32_t(std::ceil((-y - radius) * 0.5f)));
+	const std::int32_t rowHigh = std::min(getRows() - 1, std::int32_t(std::floor((radius - y) * 0.5f)));
+
+	for (std::int32_t row = rowLow; row <= rowHigh; ++row)
+	{
+		const float offset = row % 2 ? 2.0f : 1.0f;
+		const std::int32_t columnLow = std::max(-1, std::int32_t(std::ceil((x - radius - offset) * 0.5f)));
+		const std::int32_t columnHigh = std::min(mColumns, std::int32_t(std::floor((x + radius - offset) * 0.5f)));
+
+		for (std::int32_t column = columnLow; column <= columnHigh; ++column)
+		{
+			const BoardCell cell{ row, column };
+			if (get(cell) == nullptr)
+			{
+				continue;
+			}
+
+			float px, py;
+			getPositionByCell(cell, px, py);
+			if ((px - x) * (px - x) + (py - y) * (py - y) <= radius * radius)
+			{
+				cells.push_back(cell);
+			}
+		}
+	}
+}
+
+void Board::collectColors(std::vector<std::uint32_t> & colors) const
+{
+	colors.clear();
+	for (const auto& entry : mColorCounts)
+	{
+		if (entry.count > 0)
+		{
+			colors.push_back(entry.color);
+		}
+	}
+}
+
+const std::vector<BoardColorCount> & Board::getColorCounts() const
+{
+	return mColorCounts;
+}
+
+const std::int32_t Board::getLowestRow() const
+{
+	return mLowestRow;
+}
+
+const std::int32_t Board::getPlayableCount() const
+{
+	return mPlayableCount;
+}
+
+const BoardCell Board::getCellByIndex(const std::size_t index) const
+{
+	return { std::int32_t(index / std::size_t(mStride)), std::int32_t(index % std::size_t(mStride)) - 1 };
+}
+
+void Board::count(const BoardPiece & piece, const std::int32_t delta)
+{
+	if (!piece.isPlayable())
+	{
+		return;
+	}
+
+	mPlayableCount += delta;
+
+	// Timed pieces have no color until picked, and must not make others pick one
+	if (piece.color == 0U)
+	{
+		return;
+	}
+
+	// The palette is tiny, so a sorted vector beats any map
+	const auto it = std::lower_bound(mColorCounts.begin(), mColorCounts.end(), piece.color, [](const BoardColorCount & entry, const std::uint32_t color) {
+		return entry.color < color;
+	});
+
+	if (it != mColorCounts.end() && it->color == piece.color)
+	{
+		it->count += delta;
+	}
+	else
+	{
+		mColorCounts.insert(it, { piece.color, delta });
+	}
+}
+
+void Board::occupy(const std::int32_t row, const std::int32_t delta)
+{
+	if (delta == 0)
+	{
+		return;
+	}
+
+	if (std::size_t(row) >= mRowCounts.size())
+	{
+		mRowCounts.resize(std::size_t(row) + 1U, 0);
+	}
+
+	mRowCounts[row] += delta;
+
+	// Only emptying the lowest row moves it up, and rows above are usually full
+	if (delta > 0)
+	{
+		mLowestRow = std::max(mLowestRow, row);
+	}
+	else
+	{
+		while (mLowestRow >= 0 && mRowCounts[mLowestRow] == 0)
+		{
+			--mLowestRow;
+		}
+	}
+}
+
+void Board::startEpoch()
+{
+	mVisited.resize(mCells.size(), 0U);
+	if (++mEpoch == 0U)
+	{
+		std::fill(mVisited.begin(), mVisited.end(), 0U);
+		mEpoch = 1U;
+		mFirstEpoch = 1U;
+	}
+}
+
+const bool Board::isAttachedToCeiling(const BoardCell & seed, std::vector<BoardCell> & component)
+{
+	// Explore the lowest rows first, since the ceiling is at row 0
+	const auto byRow = [](const BoardCell & a, const BoardCell & b) {
+		return a.row > b.row;
+	};
+
+	startEpoch();
+	component.clear();
+	mFrontier.clear();
+	mFrontier.push_back(seed);
+	mVisited[getIndex(seed)] = mEpoch;
+
+	while (!mFrontier.empty())
+	{
+		std::pop_heap(mFrontier.begin(), mFrontier.end(), byRow);
+		const BoardCell cell = mFrontier.back();
+		mFrontier.pop_back();
+
+		/*
+			Every cell marked in this epoch is connected to the seed, so when
+			the ceiling is reached, the pending ones are attached as well.
+		*/
+		if (cell.row == 0)
+		{
+			return true;
+		}
+
+		component.push_back(cell);
+
+		for (const auto& n : getNeighbours(cell))
+		{
+			if (get(n) == nullptr)
+			{
+				continue;
+			}
+
+			/*
+				Pieces marked by an earlier search of this check are still on the
+				board only if that search reached the ceiling.
+			*/
+			std::uint32_t& visited = mVisited[getIndex(n)];
+			if (visited >= mFirstEpoch && visited != mEpoch)
+			{
+				return true;
+			}
+			if (visited != mEpoch)
+			{
+				visited = mEpoch;
+				mFrontier.push_back(n);
+				std::push_heap(mFrontier.begin(), mFrontier.end(), byRow);
+			}
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#define BOARD_NEIGHBOURS 6
+#define BOARD_MINIMUM_MATCH 3
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "BoardTypes.h"
+
+// Number of playable pieces with a color
+struct BoardColorCount
+{
+	std::uint32_t color;
+	std::int32_t count;
+};
+
+/*
+	Authoritative state of the bubbles of a level. Cells use "offset" hex
+	coordinates: even rows start at X = 1, odd rows are shifted right by
+	one unit (half bubble) and start at X = 2. Every row is 2 units tall,
+	and row 0 is the ceiling which keeps every group attached.
+*/
+class Board
+{
+public:
+	// Conversion between world positions and cells
+	static BoardCell getCellByPosition(const float x, const float y);
+	static void getPositionByCell(const BoardCell & cell, float & x, float & y);
+
+	explicit Board(const std::int32_t columns);
+
+	const std::int32_t getColumns() const;
+	const std::int32_t getRows() const;
+
+	bool isInside(const BoardCell & cell) const;
+	const BoardPiece* get(const BoardCell & cell) const;
+
+	// Kind and color of the piece must be changed with place, remove and recolor, to keep the counts right
+	BoardPiece* get(const BoardCell & cell);
+
+	void place(const BoardCell & cell, const BoardPiece & piece);
+	bool remove(const BoardCell & cell);
+	void recolor(const BoardCell & cell, const std::uint32_t color);
+	void clear();
+
+	const std::array<BoardCell, BOARD_NEIGHBOURS> getNeighbours(const BoardCell & cell) const;
+
+	// Storage index of a cell, shared with any view laid out like this board
+	const std::size_t getIndex(const BoardCell & cell) const;
+	const std::size_t getCapacity() const;
+
+	// Collect the group of pieces with the same color, connected to the given cell
+	void collectMatches(const BoardCell & cell, std::vector<BoardCell> & matches);
+
+	/*
+		Find the pieces which are no longer connected to the ceiling. Only the
+		neighbourhood of the cells removed since the last call is explored, so
+		the cost is proportional to what changed on the board. Orphans are
+		removed from the board and appended to the given list.
+	*/
+	void collectOrphans(std::vector<BoardEntry> & orphans);
+
+	// Collect the occupied cells whose center is within radius of the given point
+	void collectInRadius(const float x, const float y, const float radius, std::vector<BoardCell> & cells) const;
+
+	// Distinct colors of the playable pieces, sorted by key
+	void collectColors(std::vector<std::uint32_t> & colors) const;
+
+	/*
+		Playable pieces for every color seen on the board, sorted by key. It is
+		updated as pieces come and go, so reading it costs nothing. Colors are
+		never dropped, so their count can be zero. Pieces with color zero, as
+		timed ones before their color is picked, are left out.
+	*/
+	const std::vector<BoardColorCount> & getColorCounts() const;
+
+	// Lowest occupied row (-1 when empty) and number of playable pieces left, both kept up to date
+	const std::int32_t getLowestRow() const;
+	const std::int32_t getPlayableCount() const;
+
+	// Invoke callback for every piece, in row-major order, until it returns false
+	template <typename F>
+	void forEachPiece(F && callback) const
+	{
+		for (std::size_t i = 0; i < mCells.size(); ++i)
+		{
+			if (mCells[i].kind != BubbleKind::None && !callback(getCellByIndex(i), mCells[i]))
+			{
+				return;
+			}
+		}
+	}
+
+	/*
+		Invoke callback for every piece which may be touched by a circle of the
+		given radius, moving along the segment. Rows are visited starting from
+		the one nearest to the start. The callback returns false to stop.
+	*/
+	template <typename F>
+	void forEachAlongSegment(const float fromX, const float fromY, const float toX, const float toY, const float radius, F && callback) const
+	{
+		const float yMin = std::min(fromY, toY);
+		const float yMax = std::max(fromY, toY);
+		const float dy = toY - fromY;
+
+		// Rows whose band (row center +/- radius) overlaps the segment
+		const std::int32_t rowLow = std::max(0, std::int32_t(std::ceil((-yMax - radius) * 0.5f)));
+		const std::int32_t rowHigh = std::min(getRows() - 1, std::int32_t(std::floor((radius - yMin) * 0.5f)));
+		if (rowLow > rowHigh)
+		{
+			return;
+		}
+
+		const bool upwards = dy > 0.0f;
+		for (std::int32_t i = 0; i <= rowHigh - rowLow; ++i)
+		{
+			const std::int32_t row = upwards ? rowHigh - i : rowLow + i;
+
+			// Horizontal extent of the segment within the band
+			float xMin, xMax;
+			if (std::abs(dy) > 0.0001f)
+			{
+				const float yA = std::max(yMin, float(row) * -2.0f - radius);
+				const float yB = std::min(yMax, float(row) * -2.0f + radius);
+				const float xA = fromX + (toX - fromX) * (yA - fromY) / dy;
+				const float xB = fromX + (toX - fromX) * (yB - fromY) / dy;
+				xMin = std::min(xA, xB);
+				xMax = std::max(xA, xB);
+			}
+			else
+			{
+				xMin = std::min(fromX, toX);
+				xMax = std::max(fromX, toX);
+			}
+
+			const float offset = row % 2 ? 2.0f : 1.0f;
+			const std::int32_t columnLow = std::max(-1, std::int32_t(std::ceil((xMin - radius - offset) * 0.5f)));
+			const std::int32_t columnHigh = std::min(mColumns, std::int32_t(std::floor((xMax + radius - offset) * 0.5f)));
+
+			for (std::int32_t column = columnLow; column <= columnHigh; ++column)
+			{
+				const BoardCell cell{ row, column };
+				const BoardPiece* piece = get(cell);
+				if (piece != nullptr && !callback(cell, *piece))
+				{
+					return;
+				}
+			}
+		}
+	}
+
+protected:
+	const BoardCell getCellByIndex(const std::size_t index) const;
+	void count(const BoardPiece & piece, const std::int32_t delta);
+	void occupy(const std::int32_t row, const std::int32_t delta);
+	void startEpoch();
+	const bool isAttachedToCeiling(const BoardCell & seed, std::vector<BoardCell> & component);
+
+	/*
+		Columns are stored with one spare cell on each side, because a snapped
+		piece can be pushed just outside the side walls.
+	*/
+	std::int32_t mColumns;
+	std::int32_t mStride;
+	std::vector<BoardPiece> mCells;
+
+	// Histogram of the playable pieces, and its total
+	std::vector<BoardColorCount> mColorCounts;
+	std::int32_t mPlayableCount;
+
+	// Occupied cells of every row, and the lowest row with any
+	std::vector<std::int32_t> mRowCounts;
+	std::int32_t mLowestRow;
+
+	// Cells emptied since the last orphan check
+	std::vector<BoardCell> mRemoved;
+
+	/*
+		Visit marks for the searches. Instead of clearing them on every
+		search, the epoch is incremented, so stale marks are ignored.
+	*/
+	std::vector<std::uint32_t> mVisited;
+	std::uint32_t mEpoch;
+
+	// Epoch of the first search of the current orphan check
+	std::uint32_t mFirstEpoch;
+
+	// Scratch storage for the searches, kept to avoid allocations on each shot
+	std::vector<BoardCell> mFrontier;
+	std::vector<BoardCell> mComponent;
+};
@@ -0,0 +1,174 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include "BoardRules.h"
+#include "TestUtility.h"
+
+// Shots fired on every level at most, and the time the timed pieces are advanced by after each one
+#define BOARD_COLORS_TEST_SHOTS 300
+#define BOARD_COLORS_TEST_TIMED_STEP 1.5f
+
+/*
+	Check that the color histogram kept by the board matches a full scan of
+	its pieces after every shot, timed pieces without a color included. Then
+	check that no color is picked for the player when the histogram is
+	empty: on an empty board, and on a board with only timed pieces whose
+	color is still zero. Usage: BreakMyCircleBoardColorsTest
+*/
+
+// Compare the histogram with a scan of the board, printing the first difference
+static bool checkCounts(const Board & board, const char* when)
+{
+	std::map<std::uint32_t, std::int32_t> scan;
+	std::int32_t playable = 0;
+	board.forEachPiece([&scan, &playable](const BoardCell &, const BoardPiece & piece) {
+		if (piece.isPlayable())
+		{
+			++playable;
+			if (piece.color != 0U)
+			{
+				++scan[piece.color];
+			}
+		}
+		return true;
+	});
+
+	std::uint32_t previous = 0U;
+	for (const auto& entry : board.getColorCounts())
+	{
+		if (entry.color <= previous)
+		{
+			std::printf("%s: color %06x is zero or out of order in the histogram\n", when, entry.color);
+			return false;
+		}
+		previous = entry.color;
+
+		const auto& it = scan.find(entry.color);
+		const std::int32_t expected = it != scan.end() ? it->second : 0;
+		if (entry.count != expected)
+		{
+			std::printf("%s: %d pieces of color %06x in the histogram instead of %d\n", when, entry.count, entry.color, expected);
+			return false;
+		}
+		if (it != scan.end())
+		{
+			scan.erase(it);
+		}
+	}
+
+	if (!scan.empty())
+	{
+		std::printf("%s: color %06x is missing from the histogram\n", when, scan.begin()->first);
+		return false;
+	}
+	if (board.getPlayableCount() != playable)
+	{
+		std::printf("%s: %d playable pieces instead of %d\n", when, board.getPlayableCount(), playable);
+		return false;
+	}
+	return true;
+}
+
+int main()
+{
+	std::int32_t failures = 0;
+	std::int32_t shots = 0;
+	std::int32_t unpicked = 0;
+
+	for (const std::uint32_t levelId : { 1U, 25U, 100U, 400U, 1500U })
+	{
+		const LevelLayout layout = generateTestLayout(levelId);
+		Board board(layout.getColumns());
+		fillTestBoard(board, layout);
+
+		RandomGenerator random(levelId);
+		BoardRules rules(board, random, getTestPalette());
+
+		// Half of the timed pieces get their color, the others keep waiting with color zero
+		std::vector<BoardCell> timed;
+		board.forEachPiece([&timed](const BoardCell & cell, const BoardPiece & piece) {
+			if (piece.kind == BubbleKind::Timed)
+			{
+				timed.push_back(cell);
+			}
+			return true;
+		});
+		for (std::size_t i = 0; i < timed.size(); i += 2)
+		{
+			std::uint32_t index = 0U;
+			board.recolor(timed[i], rules.pickTimedColor(index, true));
+		}
+		unpicked += std::int32_t(timed.size() / 2);
+
+		failures += checkCounts(board, "Generated level") ? 0 : 1;
+
+		const float midX = getTestWallLength(board) * 0.5f;
+		const ProjectileMotion motion = createTestMotion(board);
+		std::vector<BoardCell> touched;
+
+		for (std::int32_t i = 0; i < BOARD_COLORS_TEST_SHOTS && !rules.isWon(); ++i)
+		{
+			const std::uint32_t color = rules.pickColor();
+			if (color == 0U)
+			{
+				break;
+			}
+
+			ProjectileState state = launchTestShot(board, getTestAngle(std::int32_t(random.next(1000U)), 1000, 0.2f));
+			std::int32_t bounces = 0;
+			touched.clear();
+			while (motion.advance(state, PROJECTILE_MOTION_STEP, touched, bounces) == ProjectileStop::None)
+			{
+			}
+			rules.shoot(state.x, state.y, midX, BubbleKind::Color, color, touched);
+			++shots;
+
+			char when[64];
+			std::snprintf(when, sizeof(when), "Level %u, shot %d", levelId, i);
+			if (!checkCounts(board, when))
+			{
+				++failures;
+				break;
+			}
+
+			// Timed pieces left on the board change color, those with color zero pick their first one
+			for (const auto& cell : timed)
+			{
+				rules.advanceTimed(cell, BOARD_COLORS_TEST_TIMED_STEP);
+			}
+			if (!checkCounts(board, when))
+			{
+				++failures;
+				break;
+			}
+		}
+	}
+
+	// Nothing to pick from an empty board
+	{
+		Board board(10);
+		RandomGenerator random(1U);
+		BoardRules rules(board, random, getTestPalette());
+		if (rules.pickColor() != 0U)
+		{
+			std::printf("A color was picked on an empty board\n");
+			++failures;
+		}
+
+		// Timed pieces waiting for a color are playable, but give nothing to pick
+		board.place({ 0, 0 }, { BubbleKind::Timed, 0U, 1.0f, 0U });
+		board.place({ 0, 1 }, { BubbleKind::Timed, 0U, 1.0f, 0U });
+		failures += checkCounts(board, "Timed pieces only") ? 0 : 1;
+		if (rules.pickColor() != 0U || board.getColorCounts().size() != 0U || rules.isWon())
+		{
+			std::printf("Timed pieces without a color were counted as a color, or as no piece at all\n");
+			++failures;
+		}
+	}
+
+	std::printf("%d shots, %d timed pieces left without a color: %d failures\n", shots, unpicked, failures);
+	return failures == 0 && shots > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
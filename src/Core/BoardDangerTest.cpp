@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "BoardRules.h"
+#include "TestUtility.h"
+
+// Columns of the boards, and the rows pieces are randomly placed in
+#define BOARD_DANGER_TEST_COLUMNS 10
+#define BOARD_DANGER_TEST_ROWS 16
+
+// Random changes made to the board, the limit line is moved every this many
+#define BOARD_DANGER_TEST_STEPS 20000
+#define BOARD_DANGER_TEST_LIMIT_STEPS 50
+
+/*
+	Check the lowest row and the end condition kept by the board rules
+	against a full scan, while pieces are randomly placed and removed and
+	the limit line is moved. Then walk the lowest piece down past the line
+	and back, checking that listeners hear that the danger starts, gets
+	closer and ends, in this order, and nothing else.
+	Usage: BreakMyCircleBoardDangerTest
+*/
+
+struct BoardDangerEvent
+{
+	bool danger;
+	std::int32_t rowsLeft;
+};
+
+// Lowest occupied row and whether any piece is below the limit line, from a scan of the board
+static bool checkScan(const Board & board, const BoardRules & rules, const float limitY, const std::int32_t step)
+{
+	std::int32_t lowest = -1;
+	bool lost = false;
+	board.forEachPiece([&lowest, &lost, limitY](const BoardCell & cell, const BoardPiece &) {
+		lowest = std::max(lowest, cell.row);
+		lost = lost || float(cell.row) * -2.0f < limitY;
+		return true;
+	});
+
+	if (board.getLowestRow() != lowest || rules.isLost() != lost)
+	{
+		std::printf("Step %d, limit %.2f: lowest row %d and lost %d instead of %d and %d\n", step, limitY, board.getLowestRow(), rules.isLost(), lowest, lost);
+		return false;
+	}
+	return true;
+}
+
+// Y of a limit line just above the given row, so that the row is the first one beyond it
+static float getLimitAbove(const std::int32_t row)
+{
+	return float(row) * -2.0f + 0.5f;
+}
+
+int main()
+{
+	std::int32_t failures = 0;
+
+	// Random changes, checked against a scan after each one
+	{
+		Board board(BOARD_DANGER_TEST_COLUMNS);
+		RandomGenerator random(7U);
+		BoardRules rules(board, random, getTestPalette());
+		std::vector<BoardEntry> orphans;
+
+		float limitY = 0.0f;
+		for (std::int32_t i = 0; i < BOARD_DANGER_TEST_STEPS && failures == 0; ++i)
+		{
+			if (i % BOARD_DANGER_TEST_LIMIT_STEPS == 0)
+			{
+				// Both on row centers and between them
+				limitY = float(random.next(BOARD_DANGER_TEST_ROWS * 4U)) * -0.5f;
+				rules.setLimit(limitY);
+			}
+
+			const BoardCell cell{ std::int32_t(random.next(BOARD_DANGER_TEST_ROWS)), std::int32_t(random.next(BOARD_DANGER_TEST_COLUMNS)) };
+			const std::uint32_t action = random.next(8U);
+			if (action < 4U)
+			{
+				board.place(cell, { BubbleKind::Color, TEST_UTILITY_COLOR_KEYS[action], 0.0f, 0U });
+			}
+			else if (action < 7U)
+			{
+				board.remove(cell);
+			}
+			else
+			{
+				orphans.clear();
+				board.collectOrphans(orphans);
+			}
+
+			failures += checkScan(board, rules, limitY, i) ? 0 : 1;
+		}
+	}
+
+	// Lowest piece walking down past the line and back up
+	{
+		Board board(BOARD_DANGER_TEST_COLUMNS);
+		RandomGenerator random(1U);
+		BoardRules rules(board, random, getTestPalette());
+
+		std::vector<BoardDangerEvent> events;
+		rules.addDangerListener([&events](const bool danger, const std::int32_t rowsLeft) {
+			events.push_back({ danger, rowsLeft });
+		});
+
+		const std::int32_t limitRow = 10;
+		rules.setLimit(getLimitAbove(limitRow));
+
+		for (std::int32_t row = 0; row <= limitRow + 2; ++row)
+		{
+			board.place({ row, 0 }, { BubbleKind::Color, TEST_UTILITY_COLOR_KEYS[0], 0.0f, 0U });
+			rules.updateDanger();
+		}
+		for (std::int32_t row = limitRow + 2; row > limitRow - 4; --row)
+		{
+			board.remove({ row, 0 });
+			rules.updateDanger();
+		}
+
+		// Lowest row is limitRow - 4 now: moving the line up brings the danger back, moving it down ends it
+		rules.setLimit(getLimitAbove(limitRow - 3));
+		rules.updateDanger();
+		rules.setLimit(getLimitAbove(limitRow + 10));
+		rules.updateDanger();
+		rules.updateDanger();
+
+		const std::vector<BoardDangerEvent> expected = {
+			{ true, 2 }, { true, 1 }, { true, 0 }, { true, -1 }, { true, -2 },
+			{ true, -1 }, { true, 0 }, { true, 1 }, { true, 2 }, { false, 3 },
+			{ true, 1 }, { false, 14 }
+		};
+
+		bool same = events.size() == expected.size();
+		for (std::size_t i = 0; same && i < events.size(); ++i)
+		{
+			same = events[i].danger == expected[i].danger && events[i].rowsLeft == expected[i].rowsLeft;
+		}
+		if (!same)
+		{
+			std::printf("Danger events:");
+			for (const auto& event : events)
+			{
+				std::printf(" %s %d", event.danger ? "on" : "off", event.rowsLeft);
+			}
+			std::printf("\n");
+			++failures;
+		}
+	}
+
+	std::printf("%d failures\n", failures);
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
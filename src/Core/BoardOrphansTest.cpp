@@ -0,0 +1,224 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "BoardRules.h"
+#include "TestUtility.h"
+
+// Runs with a different seed on every level, then pops made and shots fired on every run at most
+#define BOARD_ORPHANS_TEST_RUNS 20
+#define BOARD_ORPHANS_TEST_POPS 400
+#define BOARD_ORPHANS_TEST_SHOTS 300
+
+/*
+	Check the orphans found by the board, which only explores around the
+	removed cells, against a brute-force pass: every piece which can't be
+	reached from row 0 through its neighbours. Random pieces and groups are
+	popped from generated levels, then shots are resolved by the board
+	rules, whose dropped pieces must be exactly the unreachable ones.
+	Usage: BreakMyCircleBoardOrphansTest
+*/
+
+// Pieces which are not connected to the ceiling, flagged by storage index
+static std::vector<bool> findUnattached(const Board & board)
+{
+	std::vector<bool> attached(board.getCapacity(), false);
+	std::vector<BoardCell> frontier;
+	board.forEachPiece([&attached, &frontier, &board](const BoardCell & cell, const BoardPiece &) {
+		if (cell.row == 0)
+		{
+			attached[board.getIndex(cell)] = true;
+			frontier.push_back(cell);
+		}
+		return true;
+	});
+
+	while (!frontier.empty())
+	{
+		const BoardCell cell = frontier.back();
+		frontier.pop_back();
+		for (const auto& n : board.getNeighbours(cell))
+		{
+			if (board.get(n) != nullptr && !attached[board.getIndex(n)])
+			{
+				attached[board.getIndex(n)] = true;
+				frontier.push_back(n);
+			}
+		}
+	}
+
+	std::vector<bool> unattached(board.getCapacity(), false);
+	board.forEachPiece([&attached, &unattached, &board](const BoardCell & cell, const BoardPiece &) {
+		unattached[board.getIndex(cell)] = !attached[board.getIndex(cell)];
+		return true;
+	});
+	return unattached;
+}
+
+static std::int32_t countFlags(const std::vector<bool> & flags)
+{
+	std::int32_t count = 0;
+	for (const bool flag : flags)
+	{
+		count += flag ? 1 : 0;
+	}
+	return count;
+}
+
+// Compare a list of orphans with the expected cells, printing the first difference
+static bool checkOrphans(const Board & board, const std::vector<BoardEntry> & orphans, const std::vector<bool> & expected, const char* when)
+{
+	std::vector<bool> found(board.getCapacity(), false);
+	for (const auto& orphan : orphans)
+	{
+		const std::size_t index = board.getIndex(orphan.cell);
+		if (!expected[index] || found[index])
+		{
+			std::printf("%s: cell %d,%d dropped while attached, or twice\n", when, orphan.cell.row, orphan.cell.column);
+			return false;
+		}
+		found[index] = true;
+	}
+
+	if (std::int32_t(orphans.size()) != countFlags(expected))
+	{
+		std::printf("%s: %zu pieces dropped instead of %d\n", when, orphans.size(), countFlags(expected));
+		return false;
+	}
+	return true;
+}
+
+// Occupied cells of the board, to pick random ones from
+static void collectPieces(const Board & board, std::vector<BoardCell> & cells)
+{
+	cells.clear();
+	board.forEachPiece([&cells](const BoardCell & cell, const BoardPiece &) {
+		cells.push_back(cell);
+		return true;
+	});
+}
+
+// Generated levels may have floating pieces already, which no removal gets near
+static void removeFloating(Board & board, std::vector<BoardCell> & cells)
+{
+	const std::vector<bool> floating = findUnattached(board);
+	collectPieces(board, cells);
+	for (const auto& cell : cells)
+	{
+		if (floating[board.getIndex(cell)])
+		{
+			board.remove(cell);
+		}
+	}
+
+	std::vector<BoardEntry> orphans;
+	board.collectOrphans(orphans);
+}
+
+int main()
+{
+	std::int32_t failures = 0;
+	std::int32_t pops = 0;
+	std::int32_t dropped = 0;
+
+	for (const std::uint32_t levelId : { 1U, 25U, 100U, 400U, 1500U })
+	{
+		const LevelLayout layout = generateTestLayout(levelId);
+		std::vector<BoardCell> cells;
+		std::vector<BoardCell> matches;
+		std::vector<BoardEntry> orphans;
+		char when[64];
+
+		for (std::uint32_t run = 0U; run < BOARD_ORPHANS_TEST_RUNS; ++run)
+		{
+			RandomGenerator random(levelId * 100U + run);
+
+			// Random pops, as done by matches, bombs and electric pieces
+			{
+				Board board(layout.getColumns());
+				fillTestBoard(board, layout);
+				removeFloating(board, cells);
+
+				for (std::int32_t i = 0; i < BOARD_ORPHANS_TEST_POPS; ++i)
+				{
+					collectPieces(board, cells);
+					if (cells.empty())
+					{
+						break;
+					}
+
+					const BoardCell cell = cells[random.next(std::uint32_t(cells.size()))];
+					if (random.next(2U) == 0U)
+					{
+						matches.clear();
+						board.collectMatches(cell, matches);
+						for (const auto& match : matches)
+						{
+							board.remove(match);
+						}
+					}
+					else
+					{
+						board.remove(cell);
+					}
+					++pops;
+
+					const std::vector<bool> expected = findUnattached(board);
+					orphans.clear();
+					board.collectOrphans(orphans);
+					dropped += std::int32_t(orphans.size());
+
+					std::snprintf(when, sizeof(when), "Level %u, run %u, pop %d", levelId, run, i);
+					if (!checkOrphans(board, orphans, expected, when) || countFlags(findUnattached(board)) != 0)
+					{
+						++failures;
+						break;
+					}
+				}
+			}
+
+			// Shots resolved by the rules, whose dropped pieces are put back to find which were unattached
+			{
+				Board board(layout.getColumns());
+				fillTestBoard(board, layout);
+				removeFloating(board, cells);
+				BoardRules rules(board, random, getTestPalette());
+
+				const float midX = getTestWallLength(board) * 0.5f;
+				const ProjectileMotion motion = createTestMotion(board);
+				std::vector<BoardCell> touched;
+
+				for (std::int32_t i = 0; i < BOARD_ORPHANS_TEST_SHOTS && !rules.isWon(); ++i)
+				{
+					const std::uint32_t color = rules.pickColor();
+					ProjectileState state = launchTestShot(board, getTestAngle(std::int32_t(random.next(1000U)), 1000, 0.2f));
+					std::int32_t bounces = 0;
+					touched.clear();
+					while (motion.advance(state, PROJECTILE_MOTION_STEP, touched, bounces) == ProjectileStop::None)
+					{
+					}
+
+					const BoardShot& shot = rules.shoot(state.x, state.y, midX, BubbleKind::Color, color != 0U ? color : TEST_UTILITY_COLOR_KEYS[0], touched);
+					dropped += std::int32_t(shot.dropped.size());
+
+					Board before = board;
+					for (const auto& entry : shot.dropped)
+					{
+						before.place(entry.cell, entry.piece);
+					}
+
+					std::snprintf(when, sizeof(when), "Level %u, run %u, shot %d", levelId, run, i);
+					if (!checkOrphans(before, shot.dropped, findUnattached(before), when))
+					{
+						++failures;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	std::printf("%d pops, %d pieces dropped: %d failures\n", pops, dropped, failures);
+	return failures == 0 && dropped > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,297 @@
+#include "BoardRules.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+BoardRules::BoardRules(Board & board, RandomGenerator & random, const std::vector<std::uint32_t> & palette) : mBoard(board), mRandom(random), mPalette(palette), mLimitRow(std::numeric_limits<std::int32_t>::max()), mRowsLeft(std::numeric_limits<std::int32_t>::max())
+{
+}
+
+Board & BoardRules::getBoard()
+{
+	return mBoard;
+}
+
+const BoardCell BoardRules::snap(const float x, const float y) const
+{
+	// Pieces can't go past the ceiling
+	BoardCell cell = Board::getCellByPosition(x, std::min(y, 0.0f));
+	cell.column = std::max(-1, std::min(mBoard.getColumns(), cell.column));
+	return cell;
+}
+
+const BoardCell BoardRules::adjust(const BoardCell & cell, const float x, const float midX) const
+{
+	if (mBoard.get(cell) == nullptr)
+	{
+		return cell;
+	}
+
+	const bool hasLeft = mBoard.get({ cell.row, cell.column - 1 }) != nullptr;
+	const bool hasRight = mBoard.get({ cell.row, cell.column + 1 }) != nullptr;
+
+	if (x >= midX)
+	{
+		return { cell.row, cell.column + (hasLeft ? 1 : -1) };
+	}
+	else
+	{
+		return { cell.row, cell.column + (hasRight ? -1 : 1) };
+	}
+}
+
+const BoardShot & BoardRules::shoot(const float x, const float y, const float midX, const BubbleKind kind, const std::uint32_t color, const std::vector<BoardCell> & touched)
+{
+	mShot.color = color;
+	mShot.cell = snap(x, y);
+	mShot.placed = false;
+	mShot.popped.clear();
+	mShot.dropped.clear();
+	mShot.amount = 0;
+
+	// Plasma and electric pieces take the color of what they touched
+	if (kind == BubbleKind::Plasma || kind == BubbleKind::Electric)
+	{
+		mShot.color = getTouchedColor(x, y, touched);
+	}
+
+	if (kind == BubbleKind::Bomb)
+	{
+		// Explode everything around, except coins which must be collected
+		float cx, cy;
+		Board::getPositionByCell(mShot.cell, cx, cy);
+
+		mTargets.clear();
+		mBoard.collectInRadius(cx, cy, BOARD_RULES_BOMB_RADIUS, mTargets);
+		for (const auto& cell : mTargets)
+		{
+			if (mBoard.get(cell)->kind != BubbleKind::Coin)
+			{
+				explode(cell);
+			}
+		}
+
+		// Bombs do not count towards the amount, so they don't trigger congratulations
+		dropOrphans();
+	}
+	else if (kind == BubbleKind::Electric)
+	{
+		// Touched pieces, then random pieces of the same color, visiting the board in a fixed order
+		mTargets.assign(touched.begin(), touched.end());
+		mBoard.forEachPiece([this](const BoardCell & cell, const BoardPiece & piece) {
+			if (mRandom.next(2) == 0U && piece.color == mShot.color)
+			{
+				mTargets.push_back(cell);
+			}
+			return mTargets.size() < BOARD_RULES_ELECTRIC_TARGETS;
+		});
+
+		for (const auto& cell : mTargets)
+		{
+			const std::int32_t amount = popMatches(cell);
+			if (amount)
+			{
+				mShot.amount += amount + dropOrphans();
+			}
+		}
+	}
+	else
+	{
+		mShot.cell = adjust(mShot.cell, x, midX);
+		mShot.placed = mBoard.isInside(mShot.cell);
+
+		if (mShot.placed)
+		{
+			mBoard.place(mShot.cell, { BubbleKind::Color, mShot.color, 0.0f, 0U });
+
+			const std::int32_t amount = popMatches(mShot.cell);
+			if (amount)
+			{
+				mShot.amount = amount + dropOrphans();
+			}
+		}
+	}
+
+	updateDanger();
+	return mShot;
+}
+
+const std::uint32_t BoardRules::pickTimedColor(std::uint32_t & index, const bool isRandom)
+{
+	mBoard.collectColors(mColors);
+	if (mColors.empty())
+	{
+		index = 0U;
+		return 0U;
+	}
+
+	index = (isRandom ? mRandom.next(std::uint32_t(mColors.size())) : index + 1U) % std::uint32_t(mColors.size());
+	return mColors[index];
+}
+
+const std::uint32_t BoardRules::pickColor()
+{
+	// Timed pieces waiting for a color are playable, but not in the histogram
+	std::int32_t total = 0;
+	for (const auto& entry : mBoard.getColorCounts())
+	{
+		total += entry.count;
+	}
+
+	if (total <= 0)
+	{
+		return 0U;
+	}
+
+	// Same odds as picking one of the playable pieces
+	std::int32_t target = std::int32_t(mRandom.next(std::uint32_t(total)));
+	for (const auto& entry : mBoard.getColorCounts())
+	{
+		if (target < entry.count)
+		{
+			return entry.color;
+		}
+		target -= entry.count;
+	}
+
+	return 0U;
+}
+
+bool BoardRules::advanceTimed(const BoardCell & cell, const float deltaTime)
+{
+	BoardPiece* piece = mBoard.get(cell);
+	if (piece == nullptr || piece->kind != BubbleKind::Timed)
+	{
+		return false;
+	}
+
+	piece->timedFactor -= deltaTime * BOARD_RULES_TIMED_SPEED;
+	if (piece->timedFactor >= 0.0f)
+	{
+		return false;
+	}
+
+	piece->timedFactor = 1.0f;
+
+	std::uint32_t index = piece->timedIndex;
+	const std::uint32_t color = pickTimedColor(index, false);
+	piece->timedIndex = index;
+
+	if (color == 0U)
+	{
+		return false;
+	}
+
+	mBoard.recolor(cell, color);
+	return true;
+}
+
+void BoardRules::setLimit(const float limitY)
+{
+	// Rows are 2 units tall and go downwards, so this is the first one with "-2 * row < limitY"
+	mLimitRow = std::int32_t(std::floor(-limitY * 0.5f)) + 1;
+}
+
+void BoardRules::addDangerListener(DangerListener listener)
+{
+	mDangerListeners.push_back(std::move(listener));
+}
+
+void BoardRules::updateDanger()
+{
+	const std::int32_t rowsLeft = mLimitRow - std::max(0, mBoard.getLowestRow());
+	if (rowsLeft == mRowsLeft)
+	{
+		return;
+	}
+
+	const bool danger = rowsLeft <= BOARD_RULES_DANGER_ROWS;
+	const bool wasDanger = mRowsLeft <= BOARD_RULES_DANGER_ROWS;
+	mRowsLeft = rowsLeft;
+
+	if (danger || wasDanger)
+	{
+		for (const auto& listener : mDangerListeners)
+		{
+			listener(danger, rowsLeft);
+		}
+	}
+}
+
+bool BoardRules::isLost() const
+{
+	return mBoard.getLowestRow() >= mLimitRow;
+}
+
+bool BoardRules::isWon() const
+{
+	return mBoard.getPlayableCount() == 0;
+}
+
+void BoardRules::explode(const BoardCell & cell)
+{
+	const BoardPiece* piece = mBoard.get(cell);
+	if (piece != nullptr)
+	{
+		mShot.popped.push_back({ cell, *piece });
+		mBoard.remove(cell);
+	}
+}
+
+const std::int32_t BoardRules::popMatches(const BoardCell & cell)
+{
+	mMatches.clear();
+	mBoard.collectMatches(cell, mMatches);
+
+	if (mMatches.size() < BOARD_MINIMUM_MATCH)
+	{
+		return 0;
+	}
+
+	for (const auto& match : mMatches)
+	{
+		explode(match);
+	}
+	return std::int32_t(mMatches.size());
+}
+
+const std::int32_t BoardRules::dropOrphans()
+{
+	const std::size_t first = mShot.dropped.size();
+	mBoard.collectOrphans(mShot.dropped);
+	return std::int32_t(mShot.dropped.size() - first);
+}
+
+const std::uint32_t BoardRules::getTouchedColor(const float x, const float y, const std::vector<BoardCell> & touched) const
+{
+	// Nearest playable piece among the touched ones
+	float nearestDistance = 1000000.0f;
+	std::uint32_t color = 0U;
+	for (const auto& cell : touched)
+	{
+		const BoardPiece* piece = mBoard.get(cell);
+		if (piece == nullptr || !piece->isPlayable())
+		{
+			continue;
+		}
+
+		float px, py;
+		Board::getPositionByCell(cell, px, py);
+
+		const float distance = (px - x) * (px - x) + (py - y) * (py - y);
+		if (distance < nearestDistance)
+		{
+			nearestDistance = distance;
+			color = piece->color;
+		}
+	}
+
+	// Otherwise, a random color from the palette
+	if (color == 0U && !mPalette.empty())
+	{
+		color = mPalette[mRandom.next(std::uint32_t(mPalette.size()))];
+	}
+
+	return color;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#define BOARD_RULES_BOMB_RADIUS 6.0f
+#define BOARD_RULES_ELECTRIC_TARGETS 5
+#define BOARD_RULES_TIMED_SPEED 0.2f
+#define BOARD_RULES_DANGER_ROWS 2
+
+#include <functional>
+#include <vector>
+
+#include "Board.h"
+#include "RandomGenerator.h"
+
+// Outcome of a shot, as needed by the game to animate it
+struct BoardShot
+{
+	// Color of the shot after plasma and electric pieces took one from the board
+	std::uint32_t color;
+
+	// Cell where the shot landed, and whether a piece was left there
+	BoardCell cell;
+	bool placed;
+
+	// Pieces exploded by matching or bombs, and pieces which lost their support
+	std::vector<BoardEntry> popped;
+	std::vector<BoardEntry> dropped;
+
+	// Amount of pieces credited to the player for this shot
+	std::int32_t amount;
+};
+
+/*
+	Rules of the game, applied to a board: shot placement and matching,
+	orphan drop, bomb radius, electric and plasma recolouring, timed pieces
+	and the end conditions of a level.
+*/
+class BoardRules
+{
+public:
+	/*
+		Called when the lowest piece gets within BOARD_RULES_DANGER_ROWS rows of
+		the limit line, when it gets closer while in danger, and when it goes
+		back out of danger. "rowsLeft" is the number of rows which can still be
+		filled before the level is lost.
+	*/
+	typedef std::function<void(const bool danger, const std::int32_t rowsLeft)> DangerListener;
+
+	/*
+		Palette is the list of colors a plasma piece can take, when it doesn't
+		touch any playable piece. Random numbers are drawn from the given
+		generator only, so a level can be simulated again with the same seed.
+	*/
+	explicit BoardRules(Board & board, RandomGenerator & random, const std::vector<std::uint32_t> & palette);
+
+	Board & getBoard();
+
+	/*
+		Snap a position to its cell. When the cell is already taken, the piece
+		is moved sideways, towards the center of the board given by "midX".
+	*/
+	const BoardCell snap(const float x, const float y) const;
+	const BoardCell adjust(const BoardCell & cell, const float x, const float midX) const;
+
+	/*
+		Resolve a shot which stopped at the given position, while touching the
+		given cells. The returned reference is valid until the next shot.
+	*/
+	const BoardShot & shoot(const float x, const float y, const float midX, const BubbleKind kind, const std::uint32_t color, const std::vector<BoardCell> & touched);
+
+	// Pick a color for the player, weighted by the pieces on the board; zero when no playable piece is left
+	const std::uint32_t pickColor();
+
+	// Pick the color for a timed piece; zero when the board has no playable pieces
+	const std::uint32_t pickTimedColor(std::uint32_t & index, const bool isRandom);
+
+	// Advance the timer of a timed piece, returns true when its color changed
+	bool advanceTimed(const BoardCell & cell, const float deltaTime);
+
+	// Set the Y position of the limit line. Pieces placed below it make the level lost
+	void setLimit(const float limitY);
+
+	void addDangerListener(DangerListener listener);
+
+	// Notify listeners if the danger changed since the last call. Shots do it already
+	void updateDanger();
+
+	// End conditions: a piece crossed the limit line, or no playable piece is left
+	bool isLost() const;
+	bool isWon() const;
+
+protected:
+	void explode(const BoardCell & cell);
+	const std::int32_t popMatches(const BoardCell & cell);
+	const std::int32_t dropOrphans();
+	const std::uint32_t getTouchedColor(const float x, const float y, const std::vector<BoardCell> & touched) const;
+
+	Board& mBoard;
+	RandomGenerator& mRandom;
+	std::vector<std::uint32_t> mPalette;
+
+	// Kept across shots, to avoid allocations
+	BoardShot mShot;
+	std::vector<BoardCell> mTargets;
+	std::vector<BoardCell> mMatches;
+	std::vector<std::uint32_t> mColors;
+
+	// First row beyond the limit line, and the rows left before it as last notified
+	std::int32_t mLimitRow;
+	std::int32_t mRowsLeft;
+	std::vector<DangerListener> mDangerListeners;
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+
+/*
+	Plain data shared by the board rules and the game. Nothing in this
+	directory depends on Magnum, so the rules can run without a GL context
+	or an audio device (e.g.: simulations, tools, CI machines).
+*/
+
+// Behaviour of a piece on the board
+enum class BubbleKind : std::uint8_t
+{
+	None,
+	Color,
+	Timed,
+	Coin,
+	Bomb,
+	Plasma,
+	Electric,
+	Stone,
+	Blackhole
+};
+
+// Cell coordinates
+struct BoardCell
+{
+	std::int32_t row;
+	std::int32_t column;
+
+	bool operator==(const BoardCell & other) const
+	{
+		return row == other.row && column == other.column;
+	}
+
+	bool operator!=(const BoardCell & other) const
+	{
+		return !(*this == other);
+	}
+};
+
+// Content of a cell, the color is the sRGB key used by the game for its bubbles
+struct BoardPiece
+{
+	BubbleKind kind;
+	std::uint32_t color;
+	float timedFactor;
+	std::uint32_t timedIndex;
+
+	// Only plain and timed pieces take part in matches and in the win condition
+	bool isPlayable() const
+	{
+		return kind == BubbleKind::Color || kind == BubbleKind::Timed;
+	}
+};
+
+// Typed parameters for game objects created by code, cheaper than parsing json
+struct InstantiatorRecord
+{
+	std::int32_t type;
+	std::int32_t parent;
+	std::uint32_t color;
+	float timedDelay;
+};
+
+// A piece together with the cell it was taken from
+struct BoardEntry
+{
+	BoardCell cell;
+	BoardPiece piece;
+};
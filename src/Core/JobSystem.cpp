@@ -0,0 +1,160 @@
+#include "JobSystem.h"
+
+std::unique_ptr<JobSystem> JobSystem::singleton = nullptr;
+
+namespace
+{
+	// Queue index of the current thread, zero for non-worker threads
+	thread_local std::uint32_t sQueueIndex = 0U;
+}
+
+JobSystem::JobSystem(const std::uint32_t workers) : mQueued(0), mStop(false)
+{
+	// One queue for external submissions, plus one for every worker
+	for (std::uint32_t i = 0; i <= workers; ++i)
+	{
+		mQueues.push_back(std::make_unique<Queue>());
+	}
+
+	for (std::uint32_t i = 1; i <= workers; ++i)
+	{
+		mThreads.emplace_back(&JobSystem::workerLoop, this, i);
+	}
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(mWakeMutex);
+		mStop = true;
+	}
+	mWakeCondition.notify_all();
+
+	for (auto& thread : mThreads)
+	{
+		thread.join();
+	}
+}
+
+const std::uint32_t JobSystem::getDefaultWorkerCount()
+{
+	// Keep one core for the main thread
+	const std::uint32_t cores = std::thread::hardware_concurrency();
+	return cores > 1U ? std::min(cores - 1U, std::uint32_t(JOB_SYSTEM_MAX_WORKERS)) : 0U;
+}
+
+const std::uint32_t JobSystem::getWorkerCount() const
+{
+	return std::uint32_t(mThreads.size());
+}
+
+void JobSystem::submit(Group & group, Job job)
+{
+	++group.mPending;
+
+	// Nothing to schedule on, so run it now
+	if (mThreads.empty())
+	{
+		std::pair<Job, Group*> item{ std::move(job), &group };
+		run(item);
+		return;
+	}
+
+	{
+		Queue& queue = *mQueues[sQueueIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.jobs.emplace_back(std::move(job), &group);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mWakeMutex);
+		++mQueued;
+	}
+	mWakeCondition.notify_one();
+}
+
+void JobSystem::wait(Group & group)
+{
+	while (group.mPending.load() > 0)
+	{
+		if (!tryRunOne(sQueueIndex))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+bool JobSystem::isDone(const Group & group) const
+{
+	return group.mPending.load() == 0;
+}
+
+void JobSystem::workerLoop(const std::uint32_t index)
+{
+	sQueueIndex = index;
+
+	while (true)
+	{
+		if (tryRunOne(index))
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(mWakeMutex);
+		mWakeCondition.wait(lock, [this]() {
+			return mStop || mQueued.load() > 0;
+		});
+
+		// Jobs still queued when stopping are run first, since someone may be counting on them
+		if (mStop && mQueued.load() == 0)
+		{
+			break;
+		}
+	}
+}
+
+bool JobSystem::tryRunOne(const std::uint32_t index)
+{
+	std::pair<Job, Group*> job;
+	bool found = false;
+
+	// Own queue first, newest job (it is likely to be hot in cache)
+	{
+		Queue& queue = *mQueues[index];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.jobs.empty())
+		{
+			job = std::move(queue.jobs.back());
+			queue.jobs.pop_back();
+			found = true;
+		}
+	}
+
+	// Then steal the oldest job from the other queues
+	for (std::size_t i = 1; !found && i < mQueues.size(); ++i)
+	{
+		Queue& queue = *mQueues[(index + i) % mQueues.size()];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.jobs.empty())
+		{
+			job = std::move(queue.jobs.front());
+			queue.jobs.pop_front();
+			found = true;
+		}
+	}
+
+	if (!found)
+	{
+		return false;
+	}
+
+	--mQueued;
+	run(job);
+	return true;
+}
+
+void JobSystem::run(std::pair<Job, Group*> & job)
+{
+	job.first();
+	--job.second->mPending;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#define JOB_SYSTEM_MAX_WORKERS 4
+
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+/*
+	Persistent worker threads with a queue each, which steal from the
+	others when idle. Jobs are counted by groups, which any thread can wait
+	for, running queued jobs meanwhile instead of blocking.
+*/
+class JobSystem
+{
+public:
+	static std::unique_ptr<JobSystem> singleton;
+
+	typedef std::function<void()> Job;
+
+	// Counter for a set of jobs, which can be waited for
+	class Group
+	{
+	public:
+		Group() : mPending(0) {}
+
+	private:
+		friend class JobSystem;
+		std::atomic<std::int32_t> mPending;
+	};
+
+	/*
+		Workers are spawned once and live until the job system is destroyed,
+		which runs the jobs still queued before joining them. With zero
+		workers (single core devices), every job runs inline.
+	*/
+	explicit JobSystem(const std::uint32_t workers = getDefaultWorkerCount());
+	~JobSystem();
+
+	static const std::uint32_t getDefaultWorkerCount();
+	const std::uint32_t getWorkerCount() const;
+
+	void submit(Group & group, Job job);
+
+	// The calling thread helps by running queued jobs while waiting
+	void wait(Group & group);
+
+	// Whether all the jobs of the group are finished, without waiting for them
+	bool isDone(const Group & group) const;
+
+	/*
+		Split the range [0, count) in chunks of at least "grain" items, and
+		run "callback(begin, end)" on each of them. Small ranges run inline.
+	*/
+	template <typename F>
+	void parallelFor(const std::uint32_t count, const std::uint32_t grain, F && callback)
+	{
+		if (mThreads.empty() || count <= grain)
+		{
+			callback(0U, count);
+			return;
+		}
+
+		Group group;
+		for (std::uint32_t begin = grain; begin < count; begin += grain)
+		{
+			const std::uint32_t end = std::min(count, begin + grain);
+			submit(group, [&callback, begin, end]() {
+				callback(begin, end);
+			});
+		}
+
+		// Take the first chunk on this thread
+		callback(0U, std::min(count, grain));
+		wait(group);
+	}
+
+protected:
+	// Double-ended queue: the owner works on its back, thieves steal from the front
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<std::pair<Job, Group*>> jobs;
+	};
+
+	void workerLoop(const std::uint32_t index);
+	bool tryRunOne(const std::uint32_t index);
+	void run(std::pair<Job, Group*> & job);
+
+	// Queue 0 receives jobs from threads which are not workers
+	std::vector<std::unique_ptr<Queue>> mQueues;
+	std::vector<std::thread> mThreads;
+
+	std::mutex mWakeMutex;
+	std::condition_variable mWakeCondition;
+	std::atomic<std::int32_t> mQueued;
+	bool mStop;
+};
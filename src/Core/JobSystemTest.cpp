@@ -0,0 +1,194 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "JobSystem.h"
+
+// Jobs submitted by every check, and the range split by parallelFor
+#define JOB_SYSTEM_TEST_JOBS 2000
+#define JOB_SYSTEM_TEST_RANGE 10000U
+
+/*
+	Check the job system with and without workers: every submitted job runs
+	once before its group is done, parallelFor visits every index once,
+	workers can wait for groups of their own without a deadlock, jobs run
+	inline when there is no worker, and jobs still queued when the system
+	is destroyed are run before it returns. Usage: BreakMyCircleJobSystemTest
+*/
+
+static std::int32_t sFailures = 0;
+
+static void check(const bool condition, const std::uint32_t workers, const char* what)
+{
+	if (!condition)
+	{
+		std::printf("Failed with %u workers: %s\n", workers, what);
+		++sFailures;
+	}
+}
+
+static void checkSubmit(JobSystem & jobs, const std::uint32_t workers)
+{
+	std::atomic<std::int32_t> done(0);
+	JobSystem::Group group;
+	check(jobs.isDone(group), workers, "empty group is done");
+
+	for (std::int32_t i = 0; i < JOB_SYSTEM_TEST_JOBS; ++i)
+	{
+		jobs.submit(group, [&done]() {
+			++done;
+		});
+	}
+	jobs.wait(group);
+	check(done.load() == JOB_SYSTEM_TEST_JOBS && jobs.isDone(group), workers, "wait returns once every job ran");
+
+	// A group can be used again
+	jobs.submit(group, [&done]() {
+		++done;
+	});
+	jobs.wait(group);
+	check(done.load() == JOB_SYSTEM_TEST_JOBS + 1, workers, "group is reusable");
+}
+
+static void checkParallelFor(JobSystem & jobs, const std::uint32_t workers)
+{
+	for (const std::uint32_t grain : { 1U, 7U, 64U, JOB_SYSTEM_TEST_RANGE, JOB_SYSTEM_TEST_RANGE * 2U })
+	{
+		std::vector<std::atomic<std::int32_t>> visits(JOB_SYSTEM_TEST_RANGE);
+		for (auto& visit : visits)
+		{
+			visit = 0;
+		}
+
+		// Without workers the whole range is a single chunk
+		const std::uint32_t chunk = workers > 0U ? grain : JOB_SYSTEM_TEST_RANGE;
+		std::atomic<bool> ordered(true);
+		jobs.parallelFor(JOB_SYSTEM_TEST_RANGE, grain, [&visits, &ordered, chunk](const std::uint32_t begin, const std::uint32_t end) {
+			ordered = ordered && begin < end && end - begin <= chunk;
+			for (std::uint32_t i = begin; i < end; ++i)
+			{
+				++visits[i];
+			}
+		});
+
+		bool once = true;
+		for (const auto& visit : visits)
+		{
+			once = once && visit.load() == 1;
+		}
+		check(once && ordered.load(), workers, "parallelFor visits every index once, in chunks of the grain at most");
+	}
+
+	// Empty ranges still call back once, inline
+	std::int32_t calls = 0;
+	jobs.parallelFor(0U, 16U, [&calls](const std::uint32_t begin, const std::uint32_t end) {
+		calls += begin == 0U && end == 0U ? 1 : 100;
+	});
+	check(calls == 1, workers, "empty range runs inline");
+}
+
+static void checkNestedWaits(JobSystem & jobs, const std::uint32_t workers)
+{
+	std::atomic<std::int32_t> done(0);
+	JobSystem::Group outer;
+	for (std::int32_t i = 0; i < 64; ++i)
+	{
+		jobs.submit(outer, [&jobs, &done]() {
+			// Workers wait for jobs of their own, helping with the queues meanwhile
+			JobSystem::Group inner;
+			for (std::int32_t j = 0; j < 16; ++j)
+			{
+				jobs.submit(inner, [&done]() {
+					++done;
+				});
+			}
+			jobs.wait(inner);
+
+			jobs.parallelFor(100U, 10U, [&done](const std::uint32_t begin, const std::uint32_t end) {
+				done += std::int32_t(end - begin);
+			});
+		});
+	}
+	jobs.wait(outer);
+	check(done.load() == 64 * (16 + 100), workers, "nested waits from jobs finish");
+}
+
+static void checkInline()
+{
+	JobSystem jobs(0U);
+	check(jobs.getWorkerCount() == 0U, 0U, "no worker is spawned");
+
+	const std::thread::id caller = std::this_thread::get_id();
+	bool ran = false;
+	bool sameThread = false;
+	JobSystem::Group group;
+	jobs.submit(group, [&ran, &sameThread, caller]() {
+		ran = true;
+		sameThread = std::this_thread::get_id() == caller;
+	});
+	check(ran && sameThread && jobs.isDone(group), 0U, "submit runs the job inline");
+
+	std::int32_t chunks = 0;
+	jobs.parallelFor(1000U, 10U, [&chunks, caller](const std::uint32_t begin, const std::uint32_t end) {
+		chunks += begin == 0U && end == 1000U && std::this_thread::get_id() == caller ? 1 : 100;
+	});
+	check(chunks == 1, 0U, "parallelFor runs the whole range inline");
+}
+
+static void checkTeardown(const std::uint32_t workers)
+{
+	// Group outlives the job system, since jobs count on it until they finish
+	std::atomic<std::int32_t> done(0);
+	JobSystem::Group group;
+	{
+		JobSystem jobs(workers);
+		for (std::int32_t i = 0; i < 200; ++i)
+		{
+			jobs.submit(group, [&done]() {
+				std::this_thread::sleep_for(std::chrono::microseconds(50));
+				++done;
+			});
+		}
+	}
+	check(done.load() == 200, workers, "queued jobs run before the job system is destroyed");
+
+	// Jobs submitted right before the destruction, likely while the workers are still asleep
+	done = 0;
+	for (std::int32_t i = 0; i < 500; ++i)
+	{
+		JobSystem jobs(workers);
+		jobs.submit(group, [&done]() {
+			++done;
+		});
+	}
+	check(done.load() == 500, workers, "jobs submitted just before the destruction run");
+}
+
+int main()
+{
+	for (const std::uint32_t workers : { 1U, 2U, 4U })
+	{
+		JobSystem jobs(workers);
+		check(jobs.getWorkerCount() == workers, workers, "workers are spawned");
+
+		checkSubmit(jobs, workers);
+		checkParallelFor(jobs, workers);
+		checkNestedWaits(jobs, workers);
+		checkTeardown(workers);
+	}
+
+	{
+		JobSystem jobs(0U);
+		checkSubmit(jobs, 0U);
+		checkParallelFor(jobs, 0U);
+		checkNestedWaits(jobs, 0U);
+	}
+	checkInline();
+
+	std::printf("%d failures\n", sFailures);
+	return sFailures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,142 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <nlohmann/json.hpp>
+
+#include "TestUtility.h"
+
+// Builds per board size, the fastest one is kept
+#define LEVEL_BUILD_BENCHMARK_REPEATS 50
+
+/*
+	Compare the two ways the game passed the parameters of every bubble of a
+	level to its instantiator: a json object per cell, parsed back by
+	Bubble::getInstance, against the typed record used now. Both fill the
+	same board, so the difference is the cost of the parameters alone. Time
+	and global allocations are counted for a whole board.
+	Usage: BreakMyCircleLevelBuildBenchmark
+*/
+
+// Parameters as RoomManager::createLevelBubbles used to build them, then parsed as done by Bubble::getInstance
+static InstantiatorRecord buildFromJson(const LevelLayout & layout, const BoardCell & cell)
+{
+	const LevelLayoutCell& content = layout.get(cell);
+	const std::uint32_t k = content.kind == BubbleKind::Color ? TEST_UTILITY_COLOR_KEYS[content.color] : TEST_UTILITY_KIND_KEYS[std::size_t(content.kind)];
+
+	nlohmann::json params;
+	params["parent"] = 1;
+	params["color"] = {
+		{ "int", k },
+		{ "r", float((k >> 16) & 0xff) / 255.0f },
+		{ "g", float((k >> 8) & 0xff) / 255.0f },
+		{ "b", float(k & 0xff) / 255.0f }
+	};
+
+	if (content.kind == BubbleKind::Timed)
+	{
+		params["timedDelay"] = content.timedDelay;
+	}
+
+	InstantiatorRecord record{ 0, 0, 0U, 1.0f };
+	params.at("parent").get_to(record.parent);
+
+	float r, g, b;
+	const auto& values = params["color"];
+	values.at("r").get_to(r);
+	values.at("g").get_to(g);
+	values.at("b").get_to(b);
+	record.color = (std::uint32_t(r * 255.0f + 0.5f) << 16) | (std::uint32_t(g * 255.0f + 0.5f) << 8) | std::uint32_t(b * 255.0f + 0.5f);
+
+	const auto& it = params.find("timedDelay");
+	if (it != params.end())
+	{
+		it->get_to(record.timedDelay);
+	}
+	return record;
+}
+
+// Parameters as built by RoomManager::createLevelBubbles now
+static InstantiatorRecord buildFromRecord(const LevelLayout & layout, const BoardCell & cell)
+{
+	return layout.getRecord(cell, 0, 1, TEST_UTILITY_COLOR_KEYS, TEST_UTILITY_KIND_KEYS);
+}
+
+// Best time in microseconds and allocations of a build, checking both ways give the same board
+template <typename F>
+static void measure(const LevelLayout & layout, F && build, double & microseconds, std::size_t & allocations, std::uint64_t & checksum)
+{
+	for (std::int32_t i = 0; i < LEVEL_BUILD_BENCHMARK_REPEATS; ++i)
+	{
+		const std::size_t before = sTestAllocations;
+		const auto start = std::chrono::steady_clock::now();
+
+		Board board(layout.getColumns());
+		for (std::int32_t row = 0; row < layout.getRows(); ++row)
+		{
+			for (std::int32_t column = 0; column < layout.getColumns(); ++column)
+			{
+				const LevelLayoutCell& content = layout.get({ row, column });
+				if (content.kind != BubbleKind::None)
+				{
+					const InstantiatorRecord record = build(layout, BoardCell{ row, column });
+					board.place({ row, column }, { content.kind, record.color, record.timedDelay, 0U });
+				}
+			}
+		}
+
+		const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+		allocations = sTestAllocations - before;
+		if (i == 0 || elapsed.count() < microseconds)
+		{
+			microseconds = elapsed.count();
+		}
+
+		checksum = 0U;
+		board.forEachPiece([&checksum](const BoardCell & cell, const BoardPiece & piece) {
+			checksum = checksum * 31U + piece.color + std::uint64_t(cell.row * 1000 + cell.column);
+			return true;
+		});
+	}
+}
+
+int main()
+{
+	std::printf("%8s %8s %12s %12s %12s %12s\n", "board", "bubbles", "json (us)", "record (us)", "json allocs", "record allocs");
+
+	const std::int32_t sizes[][2] = { { 10, 9 }, { 40, 40 } };
+	for (const auto& size : sizes)
+	{
+		LevelLayoutParameters parameters = LevelLayout::getParameters(1U);
+		parameters.columns = size[0];
+		parameters.rows = size[1];
+		const LevelLayout layout = LevelLayout::generate(parameters, TEST_UTILITY_PALETTE_SIZE);
+
+		std::int32_t bubbles = 0;
+		for (std::int32_t row = 0; row < layout.getRows(); ++row)
+		{
+			for (std::int32_t column = 0; column < layout.getColumns(); ++column)
+			{
+				bubbles += layout.get({ row, column }).kind != BubbleKind::None ? 1 : 0;
+			}
+		}
+
+		double jsonTime = 0.0, recordTime = 0.0;
+		std::size_t jsonAllocations = 0, recordAllocations = 0;
+		std::uint64_t jsonChecksum = 0U, recordChecksum = 0U;
+		measure(layout, buildFromJson, jsonTime, jsonAllocations, jsonChecksum);
+		measure(layout, buildFromRecord, recordTime, recordAllocations, recordChecksum);
+
+		char name[16];
+		std::snprintf(name, sizeof(name), "%dx%d", size[0], size[1]);
+		std::printf("%8s %8d %12.1f %12.1f %12zu %12zu\n", name, bubbles, jsonTime, recordTime, jsonAllocations, recordAllocations);
+
+		if (jsonChecksum != recordChecksum)
+		{
+			std::printf("Boards built from json and from records are different\n");
+			return EXIT_FAILURE;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,267 @@
+#include "LevelLayout.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../Common/PerlinNoise.hpp"
+
+const LevelLayoutParameters LevelLayout::getParameters(const std::uint32_t levelId)
+{
+	const float flid = float(levelId);
+
+	LevelLayoutParameters parameters;
+	parameters.seed = levelId;
+	parameters.columns = std::int32_t(std::round(float(std::int32_t(levelId) % 10) * 0.2f)) + 6;
+	parameters.rows = parameters.columns - 1;
+	parameters.octaves = 4 + std::int32_t(std::fmod(flid, 12.0f));
+	parameters.frequency = 8 + double(std::fmod(flid, 56.0f));
+	return parameters;
+}
+
+const LevelLayoutConstraint LevelLayout::getConstraint(const BubbleKind kind)
+{
+	switch (kind)
+	{
+	// Coins can't be exploded without powerups when they are at the top
+	case BubbleKind::Coin:
+		return { 2, 1.0 / 3.0 };
+
+	// Other special bubbles must leave room for plain ones
+	case BubbleKind::Stone:
+	case BubbleKind::Blackhole:
+	case BubbleKind::Timed:
+		return { 0, 1.0 / 3.0 };
+
+	default:
+		return { 0, 1.0 };
+	}
+}
+
+LevelLayout LevelLayout::generate(const LevelLayoutParameters & parameters, const std::uint32_t paletteSize, LevelLayoutStats* stats)
+{
+	const std::uint32_t seed = parameters.seed;
+	const std::int32_t columns = parameters.columns;
+	const std::int32_t rows = parameters.rows;
+	const std::int32_t octaves = parameters.octaves;
+	const double frequency = parameters.frequency;
+
+	LevelLayout layout(columns, rows);
+	LevelLayoutStats counters{ 0U, 0U };
+
+	// Bubbles placed so far, for each kind
+	std::array<std::int32_t, LEVEL_LAYOUT_KINDS> counts{};
+
+	const siv::PerlinNoise perlin(seed);
+
+	const double fSeed(seed);
+	const double xf = columns / frequency;
+	const double yf = rows / frequency;
+
+	float depthBlackhole = 0.0f;
+
+	// First sample of every cell in a row, evaluated in one batch
+	std::vector<double> xs(columns);
+	std::vector<double> values(columns);
+
+	for (std::int32_t i = 0; i < rows; ++i)
+	{
+		const double y = double(i);
+
+		for (std::int32_t j = 0; j < columns; ++j)
+		{
+			const double x = double(j);
+			const double ox = fSeed * x * 0.01;
+			xs[j] = (x + ox) / xf;
+		}
+
+		perlin.accumulatedOctaveNoise2DRow_0_1(xs.data(), y + y / yf, octaves, values.data(), std::size_t(columns));
+		counters.samples += std::uint32_t(columns);
+
+		for (std::int32_t j = 0; j < columns; ++j)
+		{
+			// Working variables
+			const double x = double(j);
+
+			// Sample noise until a valid content is found, or give up and place a plain bubble
+			LevelLayoutCell content;
+			{
+				double ox = fSeed * x * 0.01;
+				double value = values[j];
+				for (std::int32_t sample = 1; ; ++sample)
+				{
+					content = getCellFromNoiseValue(seed, value, paletteSize);
+					if (isAllowed(content, i, counts, columns * rows))
+					{
+						break;
+					}
+
+					if (sample == LEVEL_LAYOUT_MAX_SAMPLES)
+					{
+						content = { BubbleKind::Color, getColorFromNoiseValue(seed, value, paletteSize), 0.0f, 0.0f };
+						++counters.fallbacks;
+						break;
+					}
+
+					ox += 0.1;
+					value = perlin.accumulatedOctaveNoise2D_0_1((x + ox) / xf, y + y / yf, octaves);
+					++counters.samples;
+				}
+
+				if (content.kind == BubbleKind::Blackhole)
+				{
+					depthBlackhole += 0.05f;
+					content.depth = depthBlackhole;
+				}
+			}
+
+			// Odd rows are shifted by half bubble, so they have one cell less
+			if (content.kind == BubbleKind::None || (i % 2 && j == columns - 1))
+			{
+				continue;
+			}
+
+			layout.set({ i, j }, content);
+			++counts[std::size_t(content.kind)];
+		}
+	}
+
+	if (stats != nullptr)
+	{
+		*stats = counters;
+	}
+
+	return layout;
+}
+
+LevelLayout::LevelLayout(const std::int32_t columns, const std::int32_t rows) : mColumns(columns), mRows(rows)
+{
+	mCells.resize(std::size_t(columns) * std::size_t(rows), LevelLayoutCell{ BubbleKind::None, 0U, 0.0f, 0.0f });
+}
+
+const std::int32_t LevelLayout::getColumns() const
+{
+	return mColumns;
+}
+
+const std::int32_t LevelLayout::getRows() const
+{
+	return mRows;
+}
+
+const LevelLayoutCell & LevelLayout::get(const BoardCell & cell) const
+{
+	return mCells[std::size_t(cell.row) * std::size_t(mColumns) + std::size_t(cell.column)];
+}
+
+void LevelLayout::set(const BoardCell & cell, const LevelLayoutCell & content)
+{
+	mCells[std::size_t(cell.row) * std::size_t(mColumns) + std::size_t(cell.column)] = content;
+}
+
+const InstantiatorRecord LevelLayout::getRecord(const BoardCell & cell, const std::int32_t type, const std::int32_t parent, const std::uint32_t* colorKeys, const std::array<std::uint32_t, LEVEL_LAYOUT_KINDS> & kindKeys) const
+{
+	const LevelLayoutCell& content = get(cell);
+	const std::uint32_t key = content.kind == BubbleKind::Color ? colorKeys[content.color] : kindKeys[std::size_t(content.kind)];
+	return { type, parent, key, content.kind == BubbleKind::Timed ? content.timedDelay : 1.0f };
+}
+
+void LevelLayout::collectDifferences(const LevelLayout & other, std::vector<BoardCell> & cells) const
+{
+	const std::int32_t rows = std::max(mRows, other.mRows);
+	const std::int32_t columns = std::max(mColumns, other.mColumns);
+	const LevelLayoutCell empty{ BubbleKind::None, 0U, 0.0f, 0.0f };
+
+	for (std::int32_t i = 0; i < rows; ++i)
+	{
+		for (std::int32_t j = 0; j < columns; ++j)
+		{
+			const bool inThis = i < mRows && j < mColumns;
+			const bool inOther = i < other.mRows && j < other.mColumns;
+			const LevelLayoutCell& a = inThis ? get({ i, j }) : empty;
+			const LevelLayoutCell& b = inOther ? other.get({ i, j }) : empty;
+			if (a != b)
+			{
+				cells.push_back({ i, j });
+			}
+		}
+	}
+}
+
+bool LevelLayout::operator==(const LevelLayout & other) const
+{
+	return mColumns == other.mColumns && mRows == other.mRows && mCells == other.mCells;
+}
+
+const bool LevelLayout::isInRange(const double source, const double dest, const double range)
+{
+	return std::abs(source - dest) < range;
+}
+
+const std::uint8_t LevelLayout::getColorFromNoiseValue(const std::uint32_t seed, const double value, const std::uint32_t paletteSize)
+{
+	const double maxIndex = 4 + std::int32_t(float(std::int32_t(seed - 1) % 100) * 0.1f);
+	return std::uint8_t((std::int32_t(seed) + std::int32_t(std::round(value * maxIndex))) % std::int32_t(paletteSize));
+}
+
+const LevelLayoutCell LevelLayout::getCellFromNoiseValue(const std::uint32_t seed, const double value, const std::uint32_t paletteSize)
+{
+	LevelLayoutCell content{ BubbleKind::None, 0U, 0.0f, 0.0f };
+
+	const bool isHole = isInRange(value, 0.09) || isInRange(value, 0.54) || isInRange(value, 0.98);
+	const bool isCoin = isInRange(value, 0.15, 0.03) || isInRange(value, 0.65, 0.03) || isInRange(value, 0.90, 0.03);
+
+	const double stf = double(seed % 25U) / 25.0 * 0.01;
+	const bool isStone = isInRange(value, 0.02, stf) || isInRange(value, 0.35, stf) || isInRange(value, 0.89, stf);
+
+	const double bhf = double(seed % 50U) / 50.0 * 0.01;
+	const bool isBlackhole = isInRange(value, 0.10, bhf) || isInRange(value, 0.42, bhf) || isInRange(value, 0.76, bhf);
+
+	const double tif = double(seed % 30U) / 10.0 * 0.01;
+	const bool isTimed = isInRange(value, 0.06, tif) || isInRange(value, 0.3, tif) || isInRange(value, 0.82, tif);
+
+	if (isHole)
+	{
+		content.kind = BubbleKind::None;
+	}
+	else if (isCoin)
+	{
+		content.kind = BubbleKind::Coin;
+	}
+	else if (isStone)
+	{
+		content.kind = BubbleKind::Stone;
+	}
+	else if (isBlackhole)
+	{
+		content.kind = BubbleKind::Blackhole;
+	}
+	else if (isTimed)
+	{
+		content.kind = BubbleKind::Timed;
+		content.timedDelay = std::fmod(float(seed % 10U) * 0.1f + float(value) * 10.0f, 1.0f);
+	}
+	else
+	{
+		content.kind = BubbleKind::Color;
+		content.color = getColorFromNoiseValue(seed, value, paletteSize);
+	}
+
+	return content;
+}
+
+const bool LevelLayout::isAllowed(const LevelLayoutCell & content, const std::int32_t row, const std::array<std::int32_t, LEVEL_LAYOUT_KINDS> & counts, const std::int32_t cells)
+{
+	const LevelLayoutConstraint constraint = getConstraint(content.kind);
+	if (row < constraint.minRow)
+	{
+		return false;
+	}
+
+	// Holes and plain bubbles have no quota
+	if (constraint.quota >= 1.0)
+	{
+		return true;
+	}
+
+	return counts[std::size_t(content.kind)] < std::int32_t(double(cells) * constraint.quota);
+}
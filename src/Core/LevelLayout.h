@@ -0,0 +1,124 @@
+#pragma once
+
+// Noise samples taken at most for a single cell, before it falls back to a plain bubble
+#define LEVEL_LAYOUT_MAX_SAMPLES 8
+
+// Number of bubble kinds, used to size counters
+#define LEVEL_LAYOUT_KINDS 9
+
+#include <array>
+#include <vector>
+
+#include "BoardTypes.h"
+
+// Parameters of the generator, as derived from a level number
+struct LevelLayoutParameters
+{
+	std::uint32_t seed;
+	std::int32_t columns;
+	std::int32_t rows;
+	std::int32_t octaves;
+	double frequency;
+};
+
+// Placement rules for a kind of bubble
+struct LevelLayoutConstraint
+{
+	// First row where the bubble can appear
+	std::int32_t minRow;
+
+	// Maximum amount in a level, as a fraction of the cells of the board
+	double quota;
+};
+
+// Counters filled while generating a layout
+struct LevelLayoutStats
+{
+	// Noise evaluations, first samples included
+	std::uint32_t samples;
+
+	// Cells which exhausted their samples and became plain bubbles
+	std::uint32_t fallbacks;
+};
+
+// Content of a cell of a generated level
+struct LevelLayoutCell
+{
+	// "None" for holes, then plain bubbles and special ones
+	BubbleKind kind;
+
+	// Index in the palette, for plain bubbles
+	std::uint8_t color;
+
+	// Z offset, used to sort overlapping blackholes
+	float depth;
+
+	// Starting phase of timed bubbles
+	float timedDelay;
+
+	bool operator==(const LevelLayoutCell & other) const
+	{
+		return kind == other.kind && color == other.color && depth == other.depth && timedDelay == other.timedDelay;
+	}
+
+	bool operator!=(const LevelLayoutCell & other) const
+	{
+		return !(*this == other);
+	}
+};
+
+/*
+	Bubbles of a level, as generated from its parameters, before anything
+	is instantiated. Generation is deterministic and has no side effect,
+	so it can run on any thread and its result can be cached or compared.
+*/
+class LevelLayout
+{
+public:
+	// Generator parameters for the given level
+	static const LevelLayoutParameters getParameters(const std::uint32_t levelId);
+
+	// Placement rules applied to the given kind of bubble
+	static const LevelLayoutConstraint getConstraint(const BubbleKind kind);
+
+	/*
+		Sample Perlin noise over the board to decide the content of every
+		cell. Plain bubbles pick one of "paletteSize" colors. A sample which
+		breaks the constraints of its kind is taken again a little further,
+		at most LEVEL_LAYOUT_MAX_SAMPLES times per cell, then the cell falls
+		back to a plain bubble. This bounds the generation time of any seed.
+	*/
+	static LevelLayout generate(const LevelLayoutParameters & parameters, const std::uint32_t paletteSize, LevelLayoutStats* stats = nullptr);
+
+	explicit LevelLayout(const std::int32_t columns = 0, const std::int32_t rows = 0);
+
+	const std::int32_t getColumns() const;
+	const std::int32_t getRows() const;
+
+	const LevelLayoutCell & get(const BoardCell & cell) const;
+	void set(const BoardCell & cell, const LevelLayoutCell & content);
+
+	/*
+		Parameters of the bubble of a cell, as given to its instantiator. Plain
+		bubbles take the key of their color from "colorKeys", by palette index,
+		the others the key of their kind from "kindKeys".
+	*/
+	const InstantiatorRecord getRecord(const BoardCell & cell, const std::int32_t type, const std::int32_t parent, const std::uint32_t* colorKeys, const std::array<std::uint32_t, LEVEL_LAYOUT_KINDS> & kindKeys) const;
+
+	// Collect the cells whose content is different in the other layout
+	void collectDifferences(const LevelLayout & other, std::vector<BoardCell> & cells) const;
+
+	bool operator==(const LevelLayout & other) const;
+
+protected:
+	static const bool isInRange(const double source, const double dest, const double range = 0.01);
+	static const std::uint8_t getColorFromNoiseValue(const std::uint32_t seed, const double value, const std::uint32_t paletteSize);
+	static const LevelLayoutCell getCellFromNoiseValue(const std::uint32_t seed, const double value, const std::uint32_t paletteSize);
+	static const bool isAllowed(const LevelLayoutCell & content, const std::int32_t row, const std::array<std::int32_t, LEVEL_LAYOUT_KINDS> & counts, const std::int32_t cells);
+
+	std::int32_t mColumns;
+	std::int32_t mRows;
+
+	// Row-major cells
+	std::vector<LevelLayoutCell> mCells;
+};
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "LevelLayout.h"
+
+// Same as the size of RoomManager::sBubbleKeys
+#define LEVEL_REPORT_PALETTE_SIZE 7
+
+// Generation is repeated to smooth out timer noise
+#define LEVEL_REPORT_REPEATS 5
+
+/*
+	Generate the layout of every level in a range and list the slowest ones,
+	with the noise samples they took and how many cells fell back to plain
+	bubbles. Usage: BreakMyCircleLevelReport [first] [last] [count]
+*/
+
+struct LevelReportEntry
+{
+	std::uint32_t levelId;
+	double microseconds;
+	LevelLayoutStats stats;
+};
+
+int main(int argc, char** argv)
+{
+	const std::uint32_t first = argc > 1 ? std::uint32_t(std::strtoul(argv[1], nullptr, 10)) : 1U;
+	const std::uint32_t last = argc > 2 ? std::uint32_t(std::strtoul(argv[2], nullptr, 10)) : 10000U;
+	const std::size_t count = argc > 3 ? std::size_t(std::strtoul(argv[3], nullptr, 10)) : 20U;
+
+	std::vector<LevelReportEntry> entries;
+	entries.reserve(last >= first ? last - first + 1U : 0U);
+
+	for (std::uint32_t levelId = first; levelId <= last && levelId != 0U; ++levelId)
+	{
+		const LevelLayoutParameters parameters = LevelLayout::getParameters(levelId);
+
+		// Keep the fastest run, which is the least disturbed by the system
+		LevelReportEntry entry{ levelId, 0.0, { 0U, 0U } };
+		for (std::int32_t i = 0; i < LEVEL_REPORT_REPEATS; ++i)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			const LevelLayout layout = LevelLayout::generate(parameters, LEVEL_REPORT_PALETTE_SIZE, &entry.stats);
+			const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+			if (i == 0 || elapsed.count() < entry.microseconds)
+			{
+				entry.microseconds = elapsed.count();
+			}
+		}
+
+		entries.push_back(entry);
+	}
+
+	std::sort(entries.begin(), entries.end(), [](const LevelReportEntry & a, const LevelReportEntry & b) {
+		return a.microseconds > b.microseconds;
+	});
+
+	std::uint32_t maxSamples = 0U;
+	std::uint32_t fallbacks = 0U;
+	for (const auto& entry : entries)
+	{
+		maxSamples = std::max(maxSamples, entry.stats.samples);
+		fallbacks += entry.stats.fallbacks;
+	}
+
+	std::printf("Levels %u to %u: %zu generated, at most %u samples per level, %u fallback cells\n", first, last, entries.size(), maxSamples, fallbacks);
+	std::printf("%8s %12s %8s %10s\n", "level", "time (us)", "samples", "fallbacks");
+
+	for (std::size_t i = 0; i < std::min(count, entries.size()); ++i)
+	{
+		const auto& entry = entries[i];
+		std::printf("%8u %12.2f %8u %10u\n", entry.levelId, entry.microseconds, entry.stats.samples, entry.stats.fallbacks);
+	}
+
+	return EXIT_SUCCESS;
+}
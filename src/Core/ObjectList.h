@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Reference to an object of a layer, which doesn't keep it alive
+struct ObjectHandle
+{
+	std::int32_t layer;
+	std::uint32_t slot;
+
+	// Unique for every insertion, zero for a null handle
+	std::uint32_t serial;
+};
+
+/*
+	Objects of a layer, stored contiguously in insertion order. Objects
+	marked for destruction are removed together, once per step, so the order
+	of the others never changes and updates run in the same order on every
+	run. Each inserted object gets a handle, which resolves to null as soon
+	as the object is removed, even if its slot is reused later. Objects are
+	also indexed by type, so callers can visit only the ones they need.
+	The game stores its GameObject here; any type with the same "mHandle",
+	"mParentIndex", "mDestroyMe" and "getType()" members can be stored.
+*/
+template <typename T>
+class ObjectList
+{
+public:
+	typedef typename std::vector<std::shared_ptr<T>>::iterator iterator;
+	typedef typename std::vector<std::shared_ptr<T>>::const_iterator const_iterator;
+
+	// Append the object and assign its handle; an object already in the list is not added again
+	void insert(const std::shared_ptr<T> & go)
+	{
+		if (get(go->mHandle) == go.get())
+		{
+			return;
+		}
+
+		std::uint32_t slot;
+		if (mFreeSlots.empty())
+		{
+			slot = std::uint32_t(mSlots.size());
+			mSlots.push_back({ 0U, 0U });
+		}
+		else
+		{
+			slot = mFreeSlots.back();
+			mFreeSlots.pop_back();
+		}
+
+		// Zero is reserved for null handles
+		const std::uint32_t serial = sNextSerial++;
+		if (sNextSerial == 0U)
+		{
+			sNextSerial = 1U;
+		}
+
+		mSlots[slot] = { serial, std::uint32_t(mObjects.size()) };
+		mObjects.push_back(go);
+		mObjectSlots.push_back(slot);
+
+		const std::size_t type = std::size_t(go->getType());
+		if (type >= mTypes.size())
+		{
+			mTypes.resize(type + 1U);
+		}
+		mTypes[type].push_back(go.get());
+
+		go->mHandle = { go->mParentIndex, slot, serial };
+	}
+
+	T* get(const ObjectHandle & handle) const
+	{
+		if (handle.serial == 0U || handle.slot >= mSlots.size() || mSlots[handle.slot].serial != handle.serial)
+		{
+			return nullptr;
+		}
+		return mObjects[mSlots[handle.slot].position].get();
+	}
+
+	/*
+		Objects of the given type (GOT_*), in insertion order. Objects marked
+		for destruction stay until the end of the step, like in the list. The
+		reference is invalidated by any insertion of the same type.
+	*/
+	const std::vector<T*> & getByType(const std::int32_t type) const
+	{
+		static const std::vector<T*> empty;
+		return type >= 0 && std::size_t(type) < mTypes.size() ? mTypes[type] : empty;
+	}
+
+	// Remove every object marked as "mDestroyMe", keeping the order of the others
+	void removeDestroyed()
+	{
+		// Indices first, while every object is still alive
+		for (auto& objects : mTypes)
+		{
+			objects.erase(std::remove_if(objects.begin(), objects.end(), [](const T* go) {
+				return go->mDestroyMe;
+			}), objects.end());
+		}
+
+		std::size_t kept = 0;
+		for (std::size_t i = 0; i < mObjects.size(); ++i)
+		{
+			const std::uint32_t slot = mObjectSlots[i];
+
+			if (mObjects[i]->mDestroyMe)
+			{
+				mSlots[slot].serial = 0U;
+				mFreeSlots.push_back(slot);
+				mRemoved.push_back(std::move(mObjects[i]));
+				continue;
+			}
+
+			if (kept != i)
+			{
+				mObjects[kept] = std::move(mObjects[i]);
+				mObjectSlots[kept] = slot;
+				mSlots[slot].position = std::uint32_t(kept);
+			}
+			++kept;
+		}
+
+		mObjects.resize(kept);
+		mObjectSlots.resize(kept);
+		mRemoved.clear();
+	}
+
+	void clear()
+	{
+		for (const std::uint32_t slot : mObjectSlots)
+		{
+			mSlots[slot].serial = 0U;
+			mFreeSlots.push_back(slot);
+		}
+
+		// Swap first, so destructors see an empty list
+		std::vector<std::shared_ptr<T>> objects;
+		objects.swap(mObjects);
+		mObjectSlots.clear();
+
+		for (auto& indexed : mTypes)
+		{
+			indexed.clear();
+		}
+	}
+
+	bool empty() const
+	{
+		return mObjects.empty();
+	}
+
+	std::size_t size() const
+	{
+		return mObjects.size();
+	}
+
+	const std::shared_ptr<T> & operator[](const std::size_t position) const
+	{
+		return mObjects[position];
+	}
+
+	iterator begin()
+	{
+		return mObjects.begin();
+	}
+
+	iterator end()
+	{
+		return mObjects.end();
+	}
+
+	const_iterator begin() const
+	{
+		return mObjects.begin();
+	}
+
+	const_iterator end() const
+	{
+		return mObjects.end();
+	}
+
+protected:
+	// Object stored in a slot, identified by its serial, and its position in the list
+	struct Slot
+	{
+		std::uint32_t serial;
+		std::uint32_t position;
+	};
+
+	static std::uint32_t sNextSerial;
+
+	std::vector<std::shared_ptr<T>> mObjects;
+	std::vector<std::uint32_t> mObjectSlots;
+	std::vector<Slot> mSlots;
+	std::vector<std::uint32_t> mFreeSlots;
+
+	// Objects by type, indexed with the type itself since types are small numbers
+	std::vector<std::vector<T*>> mTypes;
+
+	// Removed objects are released after the list is consistent again, since their destructors may use it
+	std::vector<std::shared_ptr<T>> mRemoved;
+};
+
+// Serials are shared by every list, so a handle never matches an object of another list or room
+template <typename T>
+std::uint32_t ObjectList<T>::sNextSerial = 1U;
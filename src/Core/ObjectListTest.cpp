@@ -0,0 +1,199 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "ObjectList.h"
+
+/*
+	Check the list the game keeps its objects in, with a stub object type
+	instead of GameObject: handles of removed objects stay null when their
+	slot is reused, removal keeps the order of the other objects in the list
+	and in the type index, an object is never inserted twice, and clear
+	leaves nothing reachable. Usage: BreakMyCircleObjectListTest
+*/
+
+struct ObjectListTestObject;
+typedef ObjectList<ObjectListTestObject> ObjectListTestList;
+
+// Same members as GameObject uses from the list
+struct ObjectListTestObject
+{
+	ObjectHandle mHandle = ObjectHandle{ -1, 0U, 0U };
+	std::int32_t mParentIndex;
+	bool mDestroyMe;
+	std::int32_t mType;
+	std::int32_t mId;
+
+	// Size of the list when the object is released, to check it is consistent by then
+	const ObjectListTestList* mList;
+	std::size_t* mSizeOnRelease;
+
+	ObjectListTestObject(const std::int32_t type, const std::int32_t id) : mParentIndex(3), mDestroyMe(false), mType(type), mId(id), mList(nullptr), mSizeOnRelease(nullptr)
+	{
+	}
+
+	~ObjectListTestObject()
+	{
+		if (mList != nullptr)
+		{
+			*mSizeOnRelease = mList->size();
+		}
+	}
+
+	const std::int32_t getType() const
+	{
+		return mType;
+	}
+};
+
+static std::int32_t sFailures = 0;
+
+static void check(const bool condition, const char* what)
+{
+	if (!condition)
+	{
+		std::printf("Failed: %s\n", what);
+		++sFailures;
+	}
+}
+
+// Ids of the objects of the list, or of the given type, in order
+static std::vector<std::int32_t> getIds(const ObjectListTestList & list)
+{
+	std::vector<std::int32_t> ids;
+	for (const auto& object : list)
+	{
+		ids.push_back(object->mId);
+	}
+	return ids;
+}
+
+static std::vector<std::int32_t> getIds(const std::vector<ObjectListTestObject*> & objects)
+{
+	std::vector<std::int32_t> ids;
+	for (const ObjectListTestObject* object : objects)
+	{
+		ids.push_back(object->mId);
+	}
+	return ids;
+}
+
+int main()
+{
+	// Handles resolve until removal, and never again once the slot is reused
+	{
+		ObjectListTestList list;
+		const auto a = std::make_shared<ObjectListTestObject>(1, 0);
+		const auto b = std::make_shared<ObjectListTestObject>(1, 1);
+		list.insert(a);
+		list.insert(b);
+
+		const ObjectHandle handleA = a->mHandle;
+		check(handleA.layer == 3 && handleA.serial != 0U, "insert assigns the layer and a serial");
+		check(list.get(handleA) == a.get() && list.get(b->mHandle) == b.get(), "handles resolve to their objects");
+		check(list.get(ObjectHandle{ -1, 0U, 0U }) == nullptr, "null handle resolves to null");
+
+		a->mDestroyMe = true;
+		list.removeDestroyed();
+		check(list.get(handleA) == nullptr, "handle of a removed object resolves to null");
+		check(list.get(b->mHandle) == b.get(), "other handles survive a removal");
+
+		const auto c = std::make_shared<ObjectListTestObject>(1, 2);
+		list.insert(c);
+		check(c->mHandle.slot == handleA.slot, "free slot is reused");
+		check(c->mHandle.serial != handleA.serial, "reused slot gets a new serial");
+		check(list.get(handleA) == nullptr, "old handle stays null after its slot is reused");
+		check(list.get(c->mHandle) == c.get(), "new handle resolves to the new object");
+
+		// Another list never resolves a handle it didn't give
+		ObjectListTestList other;
+		other.insert(std::make_shared<ObjectListTestObject>(1, 3));
+		check(other.get(b->mHandle) == nullptr, "handles of another list resolve to null");
+	}
+
+	// Removal keeps the order of the others, in the list and in the type index
+	{
+		ObjectListTestList list;
+		std::vector<std::shared_ptr<ObjectListTestObject>> objects;
+		for (std::int32_t i = 0; i < 10; ++i)
+		{
+			objects.push_back(std::make_shared<ObjectListTestObject>(i % 2 ? 5 : 2, i));
+			list.insert(objects.back());
+		}
+
+		for (const std::int32_t i : { 0, 3, 4, 8 })
+		{
+			objects[i]->mDestroyMe = true;
+		}
+		check(list.size() == 10U && list.getByType(2).size() == 5U, "objects marked for destruction stay until the end of the step");
+
+		std::size_t sizeOnRelease = 0U;
+		objects[4]->mList = &list;
+		objects[4]->mSizeOnRelease = &sizeOnRelease;
+		objects[4].reset();
+		list.removeDestroyed();
+
+		check(getIds(list) == std::vector<std::int32_t>({ 1, 2, 5, 6, 7, 9 }), "removal keeps the order of the list");
+		check(getIds(list.getByType(2)) == std::vector<std::int32_t>({ 2, 6 }), "removal keeps the order of the type index");
+		check(getIds(list.getByType(5)) == std::vector<std::int32_t>({ 1, 5, 7, 9 }), "removal keeps the order of another type");
+		check(list.getByType(4).empty() && list.getByType(-1).empty() && list.getByType(100).empty(), "unknown types have no objects");
+		check(sizeOnRelease == 6U, "removed objects are released once the list is consistent");
+
+		for (std::size_t i = 0; i < list.size(); ++i)
+		{
+			check(list.get(list[i]->mHandle) == list[i].get(), "handles follow their objects when compacted");
+		}
+	}
+
+	// An object is inserted once, even if inserted again
+	{
+		ObjectListTestList list;
+		const auto a = std::make_shared<ObjectListTestObject>(1, 0);
+		list.insert(a);
+		const ObjectHandle handle = a->mHandle;
+		list.insert(a);
+		check(list.size() == 1U && list.getByType(1).size() == 1U, "object inserted twice is stored once");
+		check(a->mHandle.serial == handle.serial && a->mHandle.slot == handle.slot, "second insertion keeps the handle");
+
+		// Once removed, it can be inserted again with a new handle
+		a->mDestroyMe = true;
+		list.removeDestroyed();
+		a->mDestroyMe = false;
+		list.insert(a);
+		check(list.size() == 1U && list.get(a->mHandle) == a.get() && a->mHandle.serial != handle.serial, "removed object can be inserted again");
+	}
+
+	// Clear leaves nothing reachable, and the slots are reused afterwards
+	{
+		ObjectListTestList list;
+		std::vector<ObjectHandle> handles;
+		for (std::int32_t i = 0; i < 4; ++i)
+		{
+			const auto object = std::make_shared<ObjectListTestObject>(i, i);
+			list.insert(object);
+			handles.push_back(object->mHandle);
+		}
+
+		std::size_t sizeOnRelease = 99U;
+		list[1]->mList = &list;
+		list[1]->mSizeOnRelease = &sizeOnRelease;
+		list.clear();
+
+		check(list.empty() && list.begin() == list.end(), "clear empties the list");
+		check(sizeOnRelease == 0U, "objects are released after the list is empty");
+		for (std::int32_t i = 0; i < 4; ++i)
+		{
+			check(list.get(handles[i]) == nullptr && list.getByType(i).empty(), "clear leaves no handle or type index resolving");
+		}
+
+		const auto a = std::make_shared<ObjectListTestObject>(0, 10);
+		list.insert(a);
+		check(a->mHandle.slot < 4U && list.get(a->mHandle) == a.get(), "slots are reused after clear");
+		check(getIds(list.getByType(0)) == std::vector<std::int32_t>({ 10 }), "type index starts again after clear");
+	}
+
+	std::printf("%d failures\n", sFailures);
+	return sFailures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
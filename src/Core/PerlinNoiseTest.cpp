@@ -0,0 +1,80 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "../Common/PerlinNoise.hpp"
+#include "RandomGenerator.h"
+
+// Seeds tried, with every octave count up to the largest, and rows of points per seed
+#define PERLIN_NOISE_TEST_SEEDS 200
+#define PERLIN_NOISE_TEST_OCTAVES 10
+#define PERLIN_NOISE_TEST_ROWS 4
+
+/*
+	Check that the noise evaluated a row at a time, as the level generation
+	does, is bit for bit the same as evaluated one point at a time. Rows of
+	every length around the size of the blocks are tried, with points laid
+	out as in the generated levels and at random, negative ones included.
+	Usage: BreakMyCirclePerlinNoiseTest
+*/
+
+static std::uint64_t getBits(const double value)
+{
+	std::uint64_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+int main()
+{
+	std::int32_t mismatches = 0;
+	std::int32_t points = 0;
+
+	std::vector<double> xs;
+	std::vector<double> values;
+
+	for (std::uint32_t seed = 0U; seed < PERLIN_NOISE_TEST_SEEDS; ++seed)
+	{
+		const siv::PerlinNoise perlin(seed);
+		RandomGenerator random(seed);
+
+		for (std::int32_t octaves = 1; octaves <= PERLIN_NOISE_TEST_OCTAVES; ++octaves)
+		{
+			for (std::int32_t row = 0; row < PERLIN_NOISE_TEST_ROWS; ++row)
+			{
+				// Lengths around one and two blocks, then up to the widest levels
+				const std::size_t count = std::size_t(row < 2 ? 15 + random.next(20U) : random.next(64U));
+				const bool levelLike = row % 2 == 0;
+				const double y = levelLike ? double(row) * 1.25 : (random.nextFloat() - 0.5) * 512.0;
+
+				xs.resize(count);
+				values.assign(count, -1.0);
+				for (std::size_t j = 0; j < count; ++j)
+				{
+					xs[j] = levelLike ? (double(j) + double(seed) * double(j) * 0.01) / 3.5 : (random.nextFloat() - 0.5) * 512.0;
+				}
+
+				perlin.accumulatedOctaveNoise2DRow_0_1(xs.data(), y, octaves, values.data(), count);
+
+				for (std::size_t j = 0; j < count; ++j)
+				{
+					const double expected = perlin.accumulatedOctaveNoise2D_0_1(xs[j], y, octaves);
+					if (getBits(values[j]) != getBits(expected))
+					{
+						if (mismatches < 10)
+						{
+							std::printf("Seed %u, %d octaves, point %g,%g: %.17g instead of %.17g\n", seed, octaves, xs[j], y, values[j], expected);
+						}
+						++mismatches;
+					}
+					++points;
+				}
+			}
+		}
+	}
+
+	std::printf("%d points, %d mismatches\n", points, mismatches);
+	return mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
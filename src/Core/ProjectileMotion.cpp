@@ -0,0 +1,165 @@
+#include "ProjectileMotion.h"
+
+#include <cmath>
+#include <limits>
+
+const float ProjectileMotion::getTimeOfImpact(const float fromX, const float fromY, const float deltaX, const float deltaY, const float centerX, const float centerY, const float radius)
+{
+	// Moving circle against a static one, solved on the XY plane
+	const float fx = fromX - centerX;
+	const float fy = fromY - centerY;
+
+	const float c = fx * fx + fy * fy - radius * radius;
+	if (c <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	const float b = fx * deltaX + fy * deltaY;
+	const float a = deltaX * deltaX + deltaY * deltaY;
+	if (b >= 0.0f || a <= 0.0f)
+	{
+		return std::numeric_limits<float>::max();
+	}
+
+	const float disc = b * b - a * c;
+	if (disc < 0.0f)
+	{
+		return std::numeric_limits<float>::max();
+	}
+
+	return (-b - std::sqrt(disc)) / a;
+}
+
+ProjectileMotion::ProjectileMotion(const Board & board, const float leftX, const float rightX, const float speed) : mBoard(board), mLeftX(leftX), mRightX(rightX), mSpeed(speed)
+{
+}
+
+const ProjectileStop ProjectileMotion::advance(ProjectileState & state, const float deltaTime, std::vector<BoardCell> & touched, std::int32_t & bounces) const
+{
+	state.pending += deltaTime;
+
+	while (state.pending >= PROJECTILE_MOTION_STEP)
+	{
+		state.pending -= PROJECTILE_MOTION_STEP;
+
+		pull(state);
+		const ProjectileStop stop = step(state, touched, bounces);
+		if (stop != ProjectileStop::None)
+		{
+			state.pending = 0.0f;
+			return stop;
+		}
+	}
+
+	return ProjectileStop::None;
+}
+
+void ProjectileMotion::pull(ProjectileState & state) const
+{
+	mBoard.forEachAlongSegment(state.x, state.y, state.x, state.y, PROJECTILE_MOTION_PULL_RANGE, [&](const BoardCell & cell, const BoardPiece & piece) {
+		if (piece.kind == BubbleKind::Blackhole)
+		{
+			float x, y;
+			Board::getPositionByCell(cell, x, y);
+			state.directionX += x < state.x ? -PROJECTILE_MOTION_STEP * PROJECTILE_MOTION_PULL_STRENGTH : PROJECTILE_MOTION_STEP * PROJECTILE_MOTION_PULL_STRENGTH;
+		}
+		return true;
+	});
+}
+
+const ProjectileStop ProjectileMotion::step(ProjectileState & state, std::vector<BoardCell> & touched, std::int32_t & bounces) const
+{
+	float remaining = 1.0f;
+
+	for (std::int32_t i = 0; i < PROJECTILE_MOTION_MAX_BOUNCES && remaining > 0.0f; ++i)
+	{
+		const float dx = state.directionX * PROJECTILE_MOTION_STEP * mSpeed * remaining;
+		const float dy = state.directionY * PROJECTILE_MOTION_STEP * mSpeed * remaining;
+
+		// Side walls
+		float t = 1.0f;
+		bool wall = false;
+		if (dx < 0.0f)
+		{
+			const float tw = std::max(0.0f, (mLeftX - state.x) / dx);
+			if (tw < t)
+			{
+				t = tw;
+				wall = true;
+			}
+		}
+		else if (dx > 0.0f)
+		{
+			const float tw = std::max(0.0f, (mRightX - state.x) / dx);
+			if (tw < t)
+			{
+				t = tw;
+				wall = true;
+			}
+		}
+
+		// Top ceiling
+		bool ceiling = false;
+		if (dy > 0.0f)
+		{
+			const float tc = std::max(0.0f, -state.y / dy);
+			if (tc < t)
+			{
+				t = tc;
+				wall = false;
+				ceiling = true;
+			}
+		}
+
+		// Pieces on the board, within the area covered by this step
+		float tb = t;
+		mBoard.forEachAlongSegment(state.x, state.y, state.x + dx * t, state.y + dy * t, PROJECTILE_MOTION_HIT_RADIUS, [&](const BoardCell & cell, const BoardPiece &) {
+			float x, y;
+			Board::getPositionByCell(cell, x, y);
+			tb = std::min(tb, getTimeOfImpact(state.x, state.y, dx, dy, x, y, PROJECTILE_MOTION_HIT_RADIUS));
+			return true;
+		});
+
+		// Advance to the first impact within this step
+		if (tb < t)
+		{
+			state.x += dx * tb;
+			state.y += dy * tb;
+
+			// Gather every piece touching the shot at the time of impact
+			constexpr float radius = PROJECTILE_MOTION_HIT_RADIUS + 0.01f;
+			mBoard.forEachAlongSegment(state.x, state.y, state.x, state.y, radius, [&](const BoardCell & cell, const BoardPiece &) {
+				float x, y;
+				Board::getPositionByCell(cell, x, y);
+				if ((x - state.x) * (x - state.x) + (y - state.y) * (y - state.y) <= radius * radius)
+				{
+					touched.push_back(cell);
+				}
+				return true;
+			});
+			return ProjectileStop::Piece;
+		}
+
+		state.x += dx * t;
+		state.y += dy * t;
+
+		if (ceiling)
+		{
+			return ProjectileStop::Ceiling;
+		}
+		else if (wall)
+		{
+			// Bounce against side walls, then consume the rest of the step
+			state.directionX *= -1.0f;
+			remaining *= 1.0f - t;
+			++bounces;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	return ProjectileStop::None;
+}
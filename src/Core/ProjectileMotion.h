@@ -0,0 +1,67 @@
+#pragma once
+
+#define PROJECTILE_MOTION_HIT_RADIUS 1.7f
+#define PROJECTILE_MOTION_MAX_BOUNCES 8
+
+// Duration of a simulation step, shorter than any frame the game may run at
+#define PROJECTILE_MOTION_STEP (1.0f / 240.0f)
+
+// Blackholes within this distance, on both axes, pull a shot sideways by this much per second
+#define PROJECTILE_MOTION_PULL_RANGE 7.7f
+#define PROJECTILE_MOTION_PULL_STRENGTH 4.0f
+
+#include <vector>
+
+#include "Board.h"
+
+// Position and direction of a shot, the actual velocity is the direction times the speed
+struct ProjectileState
+{
+	float x;
+	float y;
+	float directionX;
+	float directionY;
+
+	// Time left over by the last advance, always shorter than a step
+	float pending;
+};
+
+// Why a shot stopped moving
+enum class ProjectileStop : std::uint8_t
+{
+	None,
+	Piece,
+	Ceiling
+};
+
+/*
+	Motion of a shot over a board: straight lines bouncing on the side walls,
+	bent by the blackholes nearby, until it touches a piece or the ceiling.
+	Frames are split into fixed steps, and the pull of the blackholes is
+	applied on every step, so a shot always lands on the same cell for the
+	same launch, whatever the frame rate is.
+*/
+class ProjectileMotion
+{
+public:
+	// Fraction of the movement at which a moving circle touches a static one
+	static const float getTimeOfImpact(const float fromX, const float fromY, const float deltaX, const float deltaY, const float centerX, const float centerY, const float radius);
+
+	explicit ProjectileMotion(const Board & board, const float leftX, const float rightX, const float speed);
+
+	/*
+		Simulate the given time, plus what the previous call left over. When
+		the shot stops on pieces, the ones touching it are appended to
+		"touched". Wall bounces are added to "bounces".
+	*/
+	const ProjectileStop advance(ProjectileState & state, const float deltaTime, std::vector<BoardCell> & touched, std::int32_t & bounces) const;
+
+protected:
+	void pull(ProjectileState & state) const;
+	const ProjectileStop step(ProjectileState & state, std::vector<BoardCell> & touched, std::int32_t & bounces) const;
+
+	const Board& mBoard;
+	float mLeftX;
+	float mRightX;
+	float mSpeed;
+};
@@ -0,0 +1,92 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "BoardRules.h"
+#include "TestUtility.h"
+
+// Launch angles tried on every level, and the longest time a shot may fly
+#define PROJECTILE_MOTION_TEST_ANGLES 720
+#define PROJECTILE_MOTION_TEST_MAX_TIME 20.0f
+
+/*
+	Check that a shot lands on the same cell whatever the frame rate. Shots
+	are launched at many angles over generated levels, with blackholes added
+	near the player so that many shots get bent, then simulated with fixed
+	and jittery frame times. Cells are snapped with the board rules, as done
+	by the game. Usage: BreakMyCircleProjectileMotionTest
+*/
+
+static const float PROJECTILE_MOTION_TEST_FRAMES[] = { 1.0f / 30.0f, 1.0f / 60.0f, 1.0f / 75.0f, 1.0f / 144.0f, 1.0f / 240.0f, 0.0f };
+
+// Cell where a shot snaps, with frame times taken from the list, or random when zero
+static BoardCell shoot(const BoardRules & rules, const ProjectileMotion & motion, const ProjectileState & launch, const float angle, const float midX, const float frame, bool & bent)
+{
+	ProjectileState state = launch;
+	std::vector<BoardCell> touched;
+	std::int32_t bounces = 0;
+
+	RandomGenerator random(std::uint64_t(angle * 1000.0f));
+	ProjectileStop stop = ProjectileStop::None;
+	for (float time = 0.0f; stop == ProjectileStop::None && time < PROJECTILE_MOTION_TEST_MAX_TIME; )
+	{
+		const float deltaTime = frame > 0.0f ? frame : 0.002f + 0.05f * random.nextFloat();
+		stop = motion.advance(state, deltaTime, touched, bounces);
+		time += deltaTime;
+	}
+
+	bent = std::abs(std::abs(state.directionX) - std::abs(std::cos(angle))) > 0.0001f;
+	return rules.adjust(rules.snap(state.x, state.y), state.x, midX);
+}
+
+int main()
+{
+	std::int32_t mismatches = 0;
+	std::int32_t shots = 0;
+	std::int32_t bentShots = 0;
+
+	for (const std::uint32_t levelId : { 1U, 25U, 100U, 400U, 1500U })
+	{
+		const LevelLayout layout = generateTestLayout(levelId);
+		Board board(layout.getColumns());
+		fillTestBoard(board, layout);
+
+		// Blackholes hanging below the level, on both sides
+		const std::int32_t columns = layout.getColumns();
+		const std::uint32_t blackhole = TEST_UTILITY_KIND_KEYS[std::size_t(BubbleKind::Blackhole)];
+		board.place({ layout.getRows() + 1, 1 }, { BubbleKind::Blackhole, blackhole, 0.0f, 0U });
+		board.place({ layout.getRows() + 1, columns - 2 }, { BubbleKind::Blackhole, blackhole, 0.0f, 0U });
+
+		RandomGenerator random(levelId);
+		BoardRules rules(board, random, getTestPalette());
+
+		const float midX = getTestWallLength(board) * 0.5f;
+		const ProjectileMotion motion = createTestMotion(board);
+
+		for (std::int32_t i = 0; i < PROJECTILE_MOTION_TEST_ANGLES; ++i)
+		{
+			const float angle = getTestAngle(i, PROJECTILE_MOTION_TEST_ANGLES, 0.15f);
+			const ProjectileState launch = launchTestShot(board, angle);
+
+			bool bent = false;
+			const BoardCell expected = shoot(rules, motion, launch, angle, midX, PROJECTILE_MOTION_TEST_FRAMES[0], bent);
+			bentShots += bent ? 1 : 0;
+
+			for (const float frame : PROJECTILE_MOTION_TEST_FRAMES)
+			{
+				const BoardCell cell = shoot(rules, motion, launch, angle, midX, frame, bent);
+				if (cell != expected)
+				{
+					std::printf("Level %u, angle %.4f, frame %.4f: cell %d,%d instead of %d,%d\n", levelId, angle, frame, cell.row, cell.column, expected.row, expected.column);
+					++mismatches;
+				}
+				++shots;
+			}
+		}
+	}
+
+	std::printf("%d shots, %d bent by blackholes: %d landed on a different cell\n", shots, bentShots, mismatches);
+	return mismatches == 0 && bentShots > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
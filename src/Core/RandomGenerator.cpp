@@ -0,0 +1,58 @@
+#include "RandomGenerator.h"
+
+namespace
+{
+	std::uint32_t rotl(const std::uint32_t x, const std::int32_t k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+	// Used to expand a 64-bit seed into the full generator state
+	std::uint64_t splitMix64(std::uint64_t & x)
+	{
+		std::uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		return z ^ (z >> 31);
+	}
+}
+
+RandomGenerator::RandomGenerator(const std::uint64_t seed)
+{
+	this->seed(seed);
+}
+
+void RandomGenerator::seed(const std::uint64_t seed)
+{
+	std::uint64_t x = seed;
+	const std::uint64_t a = splitMix64(x);
+	const std::uint64_t b = splitMix64(x);
+	mState = { std::uint32_t(a), std::uint32_t(a >> 32), std::uint32_t(b), std::uint32_t(b >> 32) };
+}
+
+std::uint32_t RandomGenerator::next()
+{
+	const std::uint32_t result = rotl(mState[1] * 5U, 7) * 9U;
+	const std::uint32_t t = mState[1] << 9;
+
+	mState[2] ^= mState[0];
+	mState[3] ^= mState[1];
+	mState[1] ^= mState[2];
+	mState[0] ^= mState[3];
+	mState[2] ^= t;
+	mState[3] = rotl(mState[3], 11);
+
+	return result;
+}
+
+std::uint32_t RandomGenerator::next(const std::uint32_t bound)
+{
+	// Multiply-shift reduction, avoiding the modulo
+	return std::uint32_t((std::uint64_t(next()) * std::uint64_t(bound)) >> 32);
+}
+
+float RandomGenerator::nextFloat()
+{
+	// Take the upper 24 bits, so every value is exactly representable
+	return float(next() >> 8) * (1.0f / 16777216.0f);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+/*
+	Small and fast "xoshiro128**" generator. It can be used on its own,
+	for example by simulations which must not share state with the game.
+*/
+class RandomGenerator
+{
+public:
+	explicit RandomGenerator(const std::uint64_t seed = 0);
+
+	void seed(const std::uint64_t seed);
+
+	std::uint32_t next();
+	std::uint32_t next(const std::uint32_t bound);
+	float nextFloat();
+
+protected:
+	std::array<std::uint32_t, 4> mState;
+};
@@ -0,0 +1,148 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "RandomGenerator.h"
+#include "ShakeField.h"
+#include "TestUtility.h"
+
+// Ripples applied on every level, each followed by the steps of its shake
+#define SHAKE_BENCHMARK_RIPPLES 2000
+#define SHAKE_BENCHMARK_STEP (1.0f / 60.0f)
+
+// Board filled up as the worst case, far beyond any generated level
+#define SHAKE_BENCHMARK_FULL_COLUMNS 16
+#define SHAKE_BENCHMARK_FULL_ROWS 64
+
+/*
+	Measure the ripple and shake passes over the bubbles of generated levels,
+	against the per-bubble computation the game used to do on a ripple, with
+	atan2, cos, sin and a Bezier evaluation. Both passes are scalar, so this
+	shows whether they fit in a frame as they are: per pass, and per bubble.
+	Level zero stands for a full board, as the worst case.
+	Usage: BreakMyCircleShakeBenchmark
+*/
+
+struct ShakeBenchmarkBubble
+{
+	float x;
+	float y;
+	float shakeX;
+	float shakeY;
+};
+
+// Y of the cubic Bezier curve by de Casteljau steps, like the game evaluated it
+static float getBezierEasing(const float t)
+{
+	float y[4] = { 0.0f, 0.06f, 0.04f, 1.0f };
+	for (std::int32_t n = 3; n > 0; --n)
+	{
+		for (std::int32_t i = 0; i < n; ++i)
+		{
+			y[i] = y[i] + (y[i + 1] - y[i]) * t;
+		}
+	}
+	return y[0];
+}
+
+static void applyTrigRipple(std::vector<ShakeBenchmarkBubble> & bubbles, const float x, const float y, const float z)
+{
+	for (auto& bubble : bubbles)
+	{
+		const float dx = bubble.x - x;
+		const float dy = bubble.y - y;
+		const float length = std::sqrt(dx * dx + dy * dy + z * z);
+		const float angle = std::atan2(dy / length, dx / length);
+		const float amplitude = getBezierEasing(std::min(std::max(length / SHAKE_FIELD_RIPPLE_DISTANCE, 0.0f), 1.0f));
+		bubble.shakeX = std::cos(angle) * amplitude;
+		bubble.shakeY = std::sin(angle) * amplitude;
+	}
+}
+
+int main()
+{
+	std::printf("%6s %8s %20s %20s %20s %14s\n", "level", "bubbles", "ripple (us)", "shake (us)", "trig ripple (us)", "ns / bubble");
+	std::printf("%6s %8s %20s %20s %20s %14s\n", "", "", "median / p99", "median / p99", "median / p99", "ripple / shake");
+
+	for (const std::uint32_t levelId : { 1U, 100U, 1000U, 0U })
+	{
+		Board board(levelId != 0U ? generateTestLayout(levelId).getColumns() : SHAKE_BENCHMARK_FULL_COLUMNS);
+		if (levelId != 0U)
+		{
+			fillTestBoard(board, generateTestLayout(levelId));
+		}
+		else
+		{
+			for (std::int32_t row = 0; row < SHAKE_BENCHMARK_FULL_ROWS; ++row)
+			{
+				for (std::int32_t column = 0; column < SHAKE_BENCHMARK_FULL_COLUMNS; ++column)
+				{
+					board.place({ row, column }, { BubbleKind::Color, TEST_UTILITY_COLOR_KEYS[0], 0.0f, 0U });
+				}
+			}
+		}
+
+		ShakeField field;
+		std::vector<ShakeBenchmarkBubble> bubbles;
+		board.forEachPiece([&field, &bubbles, &board](const BoardCell & cell, const BoardPiece &) {
+			float x, y;
+			Board::getPositionByCell(cell, x, y);
+			field.add(board.getIndex(cell), x, y, 0.0f);
+			bubbles.push_back({ x, y, 0.0f, 0.0f });
+			return true;
+		});
+
+		RandomGenerator random(levelId);
+		std::vector<double> samples[3];
+		float checksum = 0.0f;
+
+		for (std::int32_t i = 0; i < SHAKE_BENCHMARK_RIPPLES; ++i)
+		{
+			const float x = random.nextFloat() * getTestWallLength(board);
+			const float y = float(board.getRows()) * -2.0f * random.nextFloat();
+
+			auto start = std::chrono::steady_clock::now();
+			field.applyRipple(x, y, 0.0f);
+			std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+			samples[0].push_back(elapsed.count());
+
+			// Every step of the shake, until it ends
+			for (float time = 0.0f; time < 1.0f / SHAKE_FIELD_SPEED; time += SHAKE_BENCHMARK_STEP)
+			{
+				start = std::chrono::steady_clock::now();
+				field.update(SHAKE_BENCHMARK_STEP);
+				elapsed = std::chrono::steady_clock::now() - start;
+				samples[1].push_back(elapsed.count());
+			}
+
+			start = std::chrono::steady_clock::now();
+			applyTrigRipple(bubbles, x, y, 0.0f);
+			elapsed = std::chrono::steady_clock::now() - start;
+			samples[2].push_back(elapsed.count());
+
+			float offsetX, offsetY;
+			field.getOffset(board.getIndex({ 0, 0 }), offsetX, offsetY);
+			checksum += offsetX + bubbles.front().shakeX;
+		}
+
+		double median[3], best[3], worst[3];
+		for (std::int32_t mode = 0; mode < 3; ++mode)
+		{
+			summarize(samples[mode], median[mode], best[mode], worst[mode]);
+		}
+
+		const double count = double(std::max<std::size_t>(field.size(), 1U));
+		std::printf("%6u %8zu %9.2f / %8.2f %9.2f / %8.2f %9.2f / %8.2f %6.1f / %5.1f\n", levelId, field.size(), median[0], worst[0], median[1], worst[1], median[2], worst[2], median[0] * 1000.0 / count, median[1] * 1000.0 / count);
+
+		// Keeps the passes from being optimized away
+		if (std::isnan(checksum))
+		{
+			return EXIT_FAILURE;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+// Distance from the impact at which the ripple reaches its full amplitude
+#define SHAKE_FIELD_RIPPLE_DISTANCE 10.0f
+
+// Shakes last one second divided by this, and stop once below the minimum
+#define SHAKE_FIELD_SPEED 3.0f
+#define SHAKE_FIELD_MIN 0.001f
+
+#define SHAKE_FIELD_LUT_SIZE 256
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/*
+	Ripple animation of the pieces of a board. A ripple shakes every piece
+	away from its center, the more the farther it is; pieces which would
+	barely move keep their current shake. The shake is moved forward once
+	per step, and read back by each piece as an offset on the XY plane.
+	Entries are keyed by the storage index of their cell on the board, but
+	stored densely, so both passes only visit the occupied cells.
+*/
+class ShakeField
+{
+public:
+	// Ripple easing and shake wave over [0, 1], read from lookup tables
+	static float getEasing(const float x);
+	static float getWave(const float x);
+
+	ShakeField();
+
+	// Start tracking a piece at the given position, still; a slot already tracked starts over
+	void add(const std::size_t slot, const float x, const float y, const float z);
+	void remove(const std::size_t slot);
+	void clear();
+
+	const std::size_t size() const;
+
+	void applyRipple(const float x, const float y, const float z);
+	void update(const float deltaTime);
+
+	// Offset of the piece in the given slot, zero if not tracked
+	void getOffset(const std::size_t slot, float & x, float & y) const;
+
+protected:
+	typedef std::array<float, SHAKE_FIELD_LUT_SIZE + 1> Lut;
+
+	static const Lut & getEasingLut();
+	static const Lut & getWaveLut();
+	static float lookup(const Lut & lut, const float x);
+
+	// Dense index of every slot, -1 if not tracked
+	std::vector<std::int32_t> mDense;
+
+	// Animation state, one entry per tracked piece, with its slot
+	std::vector<std::size_t> mSlots;
+	std::vector<float> mPositionX;
+	std::vector<float> mPositionY;
+	std::vector<float> mPositionZ;
+	std::vector<float> mShakeX;
+	std::vector<float> mShakeY;
+	std::vector<float> mShakeFactor;
+	std::vector<float> mOffsetX;
+	std::vector<float> mOffsetY;
+	float mShakeMax;
+};
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+
+#include "Board.h"
+#include "RandomGenerator.h"
+#include "ShakeField.h"
+
+// Largest error allowed for the lookup tables and the offsets they give, and the points sampled over [0, 1]
+#define SHAKE_FIELD_TEST_ERROR 2e-5
+#define SHAKE_FIELD_TEST_SAMPLES 100000
+
+// Columns and rows of the board, then the random changes made to it
+#define SHAKE_FIELD_TEST_COLUMNS 12
+#define SHAKE_FIELD_TEST_ROWS 20
+#define SHAKE_FIELD_TEST_STEPS 5000
+
+/*
+	Check the ripple animation of the board pieces. Both lookup tables must
+	stay within 2e-5 of the curves they replace, the Bezier easing and the
+	sine wave. Then random pieces are added and removed while ripples are
+	applied, and every offset is compared with the per-piece computation the
+	game used to do, with atan2, cos and sin, for tracked and untracked
+	cells alike; offsets combine both tables, so they get twice the error.
+	Ripples start off the plane of the pieces, so that none is close enough
+	to the center to keep its previous shake.
+	Usage: BreakMyCircleShakeFieldTest
+*/
+
+struct ShakeFieldTestPiece
+{
+	double x;
+	double y;
+	double shakeX;
+	double shakeY;
+	double factor;
+};
+
+static double getExactEasing(const double x)
+{
+	const double t = std::min(std::max(x, 0.0), 1.0);
+	const double u = 1.0 - t;
+	return 3.0 * u * u * t * 0.06 + 3.0 * u * t * t * 0.04 + t * t * t;
+}
+
+static double getExactWave(const double x)
+{
+	return std::sin(std::min(std::max(x, 0.0), 1.0) * 3.14159265358979323846);
+}
+
+// Largest difference between a lookup table and its curve, at evenly spaced points and beyond the range
+template <typename F, typename G>
+static double getLutError(F && lookup, G && exact)
+{
+	double error = 0.0;
+	for (std::int32_t i = -10; i <= SHAKE_FIELD_TEST_SAMPLES + 10; ++i)
+	{
+		const float x = float(i) / float(SHAKE_FIELD_TEST_SAMPLES);
+		error = std::max(error, std::abs(double(lookup(x)) - exact(double(x))));
+	}
+	return error;
+}
+
+int main()
+{
+	std::int32_t failures = 0;
+
+	const double easingError = getLutError(ShakeField::getEasing, getExactEasing);
+	const double waveError = getLutError(ShakeField::getWave, getExactWave);
+	if (easingError > SHAKE_FIELD_TEST_ERROR || waveError > SHAKE_FIELD_TEST_ERROR)
+	{
+		std::printf("Lookup tables off by %g (easing) and %g (wave)\n", easingError, waveError);
+		++failures;
+	}
+
+	// Random pieces, ripples and steps, against the old per-piece computation
+	const Board board(SHAKE_FIELD_TEST_COLUMNS);
+	RandomGenerator random(3U);
+	ShakeField field;
+	std::map<std::size_t, ShakeFieldTestPiece> pieces;
+	double offsetError = 0.0;
+
+	for (std::int32_t i = 0; i < SHAKE_FIELD_TEST_STEPS && failures == 0; ++i)
+	{
+		const BoardCell cell{ std::int32_t(random.next(SHAKE_FIELD_TEST_ROWS)), std::int32_t(random.next(SHAKE_FIELD_TEST_COLUMNS)) };
+		const std::size_t slot = board.getIndex(cell);
+		const std::uint32_t action = random.next(10U);
+
+		if (action < 4U)
+		{
+			float x, y;
+			Board::getPositionByCell(cell, x, y);
+			field.add(slot, x, y, 0.0f);
+			pieces[slot] = { double(x), double(y), 0.0, 0.0, 0.0 };
+		}
+		else if (action < 7U)
+		{
+			field.remove(slot);
+			pieces.erase(slot);
+		}
+		else if (action < 8U)
+		{
+			const float centerX = random.nextFloat() * float(SHAKE_FIELD_TEST_COLUMNS * 2);
+			const float centerY = random.nextFloat() * float(SHAKE_FIELD_TEST_ROWS) * -2.0f;
+			// Off the plane of the pieces, so that every one of them is shaken
+			const float centerZ = 0.5f + random.nextFloat();
+			field.applyRipple(centerX, centerY, centerZ);
+
+			for (auto& entry : pieces)
+			{
+				ShakeFieldTestPiece& piece = entry.second;
+				const double dx = piece.x - centerX;
+				const double dy = piece.y - centerY;
+				const double dz = 0.0 - centerZ;
+				const double amplitude = getExactEasing(std::sqrt(dx * dx + dy * dy + dz * dz) / SHAKE_FIELD_RIPPLE_DISTANCE);
+
+				const double angle = std::atan2(dy, dx);
+				piece.shakeX = std::cos(angle) * amplitude;
+				piece.shakeY = std::sin(angle) * amplitude;
+				piece.factor = 1.0;
+			}
+		}
+		else
+		{
+			const float deltaTime = 1.0f / 60.0f;
+			field.update(deltaTime);
+			for (auto& entry : pieces)
+			{
+				ShakeFieldTestPiece& piece = entry.second;
+				piece.factor = piece.factor > 0.0 ? piece.factor - double(float(deltaTime * SHAKE_FIELD_SPEED)) : 0.0;
+			}
+		}
+
+		if (field.size() != pieces.size())
+		{
+			std::printf("Step %d: %zu pieces tracked instead of %zu\n", i, field.size(), pieces.size());
+			++failures;
+		}
+
+		// Offsets are only refreshed by updates, so compare right after them
+		if (action < 8U)
+		{
+			continue;
+		}
+
+		for (std::int32_t row = 0; row < SHAKE_FIELD_TEST_ROWS; ++row)
+		{
+			for (std::int32_t column = 0; column < SHAKE_FIELD_TEST_COLUMNS; ++column)
+			{
+				float x, y;
+				const std::size_t index = board.getIndex({ row, column });
+				field.getOffset(index, x, y);
+
+				const auto found = pieces.find(index);
+				double expectedX = 0.0, expectedY = 0.0;
+				if (found != pieces.end() && found->second.factor > SHAKE_FIELD_MIN + SHAKE_FIELD_TEST_ERROR)
+				{
+					const double wave = getExactWave(found->second.factor);
+					expectedX = found->second.shakeX * wave;
+					expectedY = found->second.shakeY * wave;
+				}
+				else if (found != pieces.end() && found->second.factor > SHAKE_FIELD_MIN - SHAKE_FIELD_TEST_ERROR)
+				{
+					// Stopping now or on the next step, either is right
+					continue;
+				}
+				offsetError = std::max(offsetError, std::max(std::abs(double(x) - expectedX), std::abs(double(y) - expectedY)));
+			}
+		}
+
+		if (offsetError > 2.0 * SHAKE_FIELD_TEST_ERROR)
+		{
+			std::printf("Step %d: offsets off by %g\n", i, offsetError);
+			++failures;
+		}
+	}
+
+	std::printf("Lookup tables off by %g (easing) and %g (wave), offsets by %g: %d failures\n", easingError, waveError, offsetError, failures);
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
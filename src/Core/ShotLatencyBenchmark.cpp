@@ -0,0 +1,120 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "BoardRules.h"
+#include "JobSystem.h"
+#include "TestUtility.h"
+
+// Shots resolved on every level
+#define SHOT_LATENCY_BENCHMARK_SHOTS 2000
+
+/*
+	Measure the time taken to resolve a shot once it hit the board, as the
+	game used to do it and as it does now. The game used to hand the flood
+	fill to std::async and the position adjustment to a std::thread, joining
+	both right away, so every shot paid for two thread creations. Now both
+	run inline; handing the shot to the job system and waiting for it is
+	measured too, as the cost of moving it off the main thread. Landing points come from the projectile motion, then every
+	shot is resolved on a fresh copy of the level, which is not timed.
+	Usage: BreakMyCircleShotLatencyBenchmark
+*/
+
+struct ShotLatencyLanding
+{
+	float x;
+	float y;
+	std::vector<BoardCell> touched;
+};
+
+int main()
+{
+	std::printf("%6s %20s %20s %20s %20s\n", "level", "inline (us)", "async (us)", "async+thread (us)", "jobs (us)");
+	std::printf("%6s %20s %20s %20s %20s\n", "", "median / p99", "median / p99", "median / p99", "median / p99");
+
+	// Workers are spawned once, like the game does
+	JobSystem jobs;
+
+	const std::vector<std::uint32_t> palette = getTestPalette();
+	const std::uint32_t color = palette[0];
+
+	for (const std::uint32_t levelId : { 1U, 100U, 1000U })
+	{
+		const LevelLayout layout = generateTestLayout(levelId);
+		Board level(layout.getColumns());
+		fillTestBoard(level, layout);
+
+		const float midX = getTestWallLength(level) * 0.5f;
+		const ProjectileMotion motion = createTestMotion(level);
+
+		std::vector<ShotLatencyLanding> landings(SHOT_LATENCY_BENCHMARK_SHOTS);
+		for (std::int32_t i = 0; i < SHOT_LATENCY_BENCHMARK_SHOTS; ++i)
+		{
+			ProjectileState state = launchTestShot(level, getTestAngle(i, SHOT_LATENCY_BENCHMARK_SHOTS, 0.2f));
+			std::int32_t bounces = 0;
+			while (motion.advance(state, PROJECTILE_MOTION_STEP, landings[i].touched, bounces) == ProjectileStop::None)
+			{
+			}
+			landings[i].x = state.x;
+			landings[i].y = state.y;
+		}
+
+		std::vector<double> samples[4];
+		for (std::int32_t mode = 0; mode < 4; ++mode)
+		{
+			samples[mode].reserve(SHOT_LATENCY_BENCHMARK_SHOTS);
+
+			for (std::int32_t i = 0; i < SHOT_LATENCY_BENCHMARK_SHOTS; ++i)
+			{
+				Board board = level;
+				RandomGenerator random(levelId * 10000U + std::uint32_t(i));
+				BoardRules rules(board, random, palette);
+				const ShotLatencyLanding& landing = landings[i];
+
+				const auto start = std::chrono::steady_clock::now();
+				if (mode == 0)
+				{
+					rules.shoot(landing.x, landing.y, midX, BubbleKind::Color, color, landing.touched);
+				}
+				else if (mode == 1)
+				{
+					std::async(std::launch::async, [&]() {
+						rules.shoot(landing.x, landing.y, midX, BubbleKind::Color, color, landing.touched);
+					}).get();
+				}
+				else if (mode == 2)
+				{
+					// Old adjustment thread did little work, so an empty one stands for it
+					std::async(std::launch::async, [&]() {
+						rules.shoot(landing.x, landing.y, midX, BubbleKind::Color, color, landing.touched);
+					}).get();
+					std::thread([]() {}).join();
+				}
+				else
+				{
+					JobSystem::Group group;
+					jobs.submit(group, [&]() {
+						rules.shoot(landing.x, landing.y, midX, BubbleKind::Color, color, landing.touched);
+					});
+					jobs.wait(group);
+				}
+				const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+				samples[mode].push_back(elapsed.count());
+			}
+		}
+
+		double median[4], best[4], worst[4];
+		for (std::int32_t mode = 0; mode < 4; ++mode)
+		{
+			summarize(samples[mode], median[mode], best[mode], worst[mode]);
+		}
+
+		std::printf("%6u %9.2f / %8.2f %9.2f / %8.2f %9.2f / %8.2f %9.2f / %8.2f\n", levelId, median[0], worst[0], median[1], worst[1], median[2], worst[2], median[3], worst[3]);
+	}
+
+	return EXIT_SUCCESS;
+}
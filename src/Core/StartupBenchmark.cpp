@@ -0,0 +1,129 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "AssetArchive.h"
+#include "TestUtility.h"
+
+// Startups replayed for every way of loading, the median and the fastest are shown
+#define STARTUP_BENCHMARK_REPEATS 20
+
+/*
+	Measure the asset I/O done at startup, with loose files as the game used
+	to read them, and with the archive: opening it, reading its table of
+	contents and touching every byte of every entry, so that all pages are
+	actually mapped in. Each startup opens the archive again. Both ways must
+	read the same bytes. Caches are warm after the first run, so this shows
+	the cost of the calls and copies rather than of the disk.
+	Usage: BreakMyCircleStartupBenchmark <asset dir> [archive]
+*/
+
+static std::uint64_t loadLoose(const std::string & root, const std::vector<std::string> & names)
+{
+	std::uint64_t sum = 0;
+	for (const auto& name : names)
+	{
+		std::ifstream in(root + name, std::ios::binary | std::ios::ate);
+		std::string content(std::size_t(in.tellg()), '\0');
+		in.seekg(0);
+		in.read(&content[0], std::streamsize(content.size()));
+		for (const char c : content)
+		{
+			sum += std::uint8_t(c);
+		}
+	}
+	return sum;
+}
+
+static std::uint64_t loadPacked(const AssetArchive & archive, const std::vector<std::string> & names)
+{
+	std::uint64_t sum = 0;
+	for (const auto& name : names)
+	{
+		const AssetArchiveView view = archive.find(name);
+		for (std::size_t i = 0; i < view.size; ++i)
+		{
+			sum += std::uint8_t(view.data[i]);
+		}
+	}
+	return sum;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::printf("Usage: %s <asset dir> [archive]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::string root = argv[1];
+	if (!root.empty() && root.back() != '/')
+	{
+		root += '/';
+	}
+	const std::string filename = argc > 2 ? argv[2] : root + ASSET_ARCHIVE_FILENAME;
+
+	// Loose files are the ones packed in the archive, since the archive lists them
+	std::vector<std::string> names;
+	std::size_t bytes = 0;
+	{
+		AssetArchive archive;
+		if (!archive.open(filename))
+		{
+			std::printf("Could not open %s, run BreakMyCircleAssetPacker first\n", filename.c_str());
+			return EXIT_FAILURE;
+		}
+		names = archive.getNames();
+		for (const auto& name : names)
+		{
+			bytes += archive.find(name).size;
+		}
+	}
+
+	std::vector<double> samples[2];
+	std::uint64_t sums[2] = { 0, 0 };
+	for (std::int32_t i = 0; i < STARTUP_BENCHMARK_REPEATS; ++i)
+	{
+		{
+			const auto start = std::chrono::steady_clock::now();
+			sums[0] = loadLoose(root, names);
+			const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+			samples[0].push_back(elapsed.count());
+		}
+
+		{
+			const auto start = std::chrono::steady_clock::now();
+			AssetArchive archive;
+			if (archive.open(filename))
+			{
+				sums[1] = loadPacked(archive, names);
+			}
+			archive.close();
+			const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+			samples[1].push_back(elapsed.count());
+		}
+	}
+
+	if (sums[0] != sums[1])
+	{
+		std::printf("Archive contents differ from the loose files\n");
+		return EXIT_FAILURE;
+	}
+
+	double median[2], best[2], worst[2];
+	for (std::int32_t mode = 0; mode < 2; ++mode)
+	{
+		summarize(samples[mode], median[mode], best[mode], worst[mode]);
+	}
+
+	std::printf("%zu assets, %.1f MB, %d startups\n", names.size(), double(bytes) / (1024.0 * 1024.0), STARTUP_BENCHMARK_REPEATS);
+	std::printf("%12s %12s %12s\n", "", "median (ms)", "best (ms)");
+	std::printf("%12s %12.3f %12.3f\n", "loose files", median[0], best[0]);
+	std::printf("%12s %12.3f %12.3f\n", "archive", median[1], best[1]);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+// Same as RoomManager::sBubbleKeys size and as the speed of a projectile in the game
+#define TEST_UTILITY_PALETTE_SIZE 7
+#define TEST_UTILITY_SPEED 30.0f
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "Board.h"
+#include "LevelLayout.h"
+#include "ProjectileMotion.h"
+
+/*
+	Helpers shared by the tests and the benchmarks of the core. Each of them
+	is a single translation unit, so this header is included once per
+	executable, global operator new included.
+*/
+
+// Same as RoomManager::sBubbleKeys and RoomManager::sKindKeys, the sRGB keys of the colors of the bubbles
+static const std::uint32_t TEST_UTILITY_COLOR_KEYS[TEST_UTILITY_PALETTE_SIZE] = { 0xff0000U, 0x00ff00U, 0x0000ffU, 0xffff00U, 0xff00ffU, 0xffbc00U, 0x00ffffU };
+static const std::array<std::uint32_t, LEVEL_LAYOUT_KINDS> TEST_UTILITY_KIND_KEYS = { 0U, 0U, 0x00002eU, 0x00000dU, 0x000016U, 0x00001cU, 0x000022U, 0x000026U, 0x00002aU };
+
+// Global allocations made so far by the executable
+static std::size_t sTestAllocations = 0;
+
+void* operator new(std::size_t size)
+{
+	++sTestAllocations;
+	if (void* p = std::malloc(size ? size : 1))
+	{
+		return p;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+// Colors a plasma piece can take, as given by the game to the board rules
+inline std::vector<std::uint32_t> getTestPalette()
+{
+	return std::vector<std::uint32_t>(TEST_UTILITY_COLOR_KEYS, TEST_UTILITY_COLOR_KEYS + TEST_UTILITY_PALETTE_SIZE);
+}
+
+// Generated layout of the given level, with the palette of the game
+inline LevelLayout generateTestLayout(const std::uint32_t levelId)
+{
+	return LevelLayout::generate(LevelLayout::getParameters(levelId), TEST_UTILITY_PALETTE_SIZE);
+}
+
+/*
+	Place the bubbles of a layout on the board, with the keys the game gives
+	them. Timed pieces have color zero, as in the game until the board
+	rules pick their color.
+*/
+inline void fillTestBoard(Board & board, const LevelLayout & layout)
+{
+	for (std::int32_t row = 0; row < layout.getRows(); ++row)
+	{
+		for (std::int32_t column = 0; column < layout.getColumns(); ++column)
+		{
+			const BoardCell cell{ row, column };
+			const BubbleKind kind = layout.get(cell).kind;
+			if (kind != BubbleKind::None)
+			{
+				const InstantiatorRecord record = layout.getRecord(cell, 0, 0, TEST_UTILITY_COLOR_KEYS, TEST_UTILITY_KIND_KEYS);
+				board.place(cell, { kind, kind == BubbleKind::Timed ? 0U : record.color, 0.0f, 0U });
+			}
+		}
+	}
+}
+
+// Side walls and player position of the game, for a board of the given columns
+inline float getTestWallLength(const Board & board)
+{
+	return float(board.getColumns()) * 2.0f;
+}
+
+inline ProjectileMotion createTestMotion(const Board & board)
+{
+	return ProjectileMotion(board, 1.0f, getTestWallLength(board) - 1.0f, TEST_UTILITY_SPEED);
+}
+
+inline ProjectileState launchTestShot(const Board & board, const float angle)
+{
+	const float len = getTestWallLength(board);
+	return { len * 0.5f, -13.0f - len, std::cos(angle), std::sin(angle), 0.0f };
+}
+
+// Launch angle of the i-th of "count" shots, spread between the walls with the given margin
+inline float getTestAngle(const std::int32_t i, const std::int32_t count, const float margin)
+{
+	return margin + (3.14159265f - 2.0f * margin) * float(i) / float(count - 1);
+}
+
+// Sort the samples and take the median, the fastest and the 99th percentile
+inline void summarize(std::vector<double> & samples, double & median, double & best, double & worst)
+{
+	std::sort(samples.begin(), samples.end());
+	median = samples[samples.size() / 2];
+	best = samples.front();
+	worst = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+}
@@ -0,0 +1,122 @@
+#include "BubbleGrid.h"
+
+#include "Bubble.h"
+
+BubbleGrid::Cell BubbleGrid::getCellByPosition(const Vector3 & position)
+{
+	return Board::getCellByPosition(position.x(), position.y());
+}
+
+Vector3 BubbleGrid::getPositionByCell(const Cell & cell, const Float z)
+{
+	Vector3 position(0.0f, 0.0f, z);
+	Board::getPositionByCell(cell, position[0], position[1]);
+	return position;
+}
+
+BubbleGrid::BubbleGrid(const Int columns) : mColumns(columns), mBoard(columns)
+{
+}
+
+const Int BubbleGrid::getColumns() const
+{
+	return mColumns;
+}
+
+const Int BubbleGrid::getRows() const
+{
+	return mBoard.getRows();
+}
+
+Board & BubbleGrid::getBoard()
+{
+	return mBoard;
+}
+
+bool BubbleGrid::isInside(const Cell & cell) const
+{
+	return mBoard.isInside(cell);
+}
+
+Bubble* BubbleGrid::get(const Cell & cell) const
+{
+	if (!isInside(cell))
+	{
+		return nullptr;
+	}
+
+	const std::size_t index = mBoard.getIndex(cell);
+	return index < mCells.size() ? mCells[index] : nullptr;
+}
+
+void BubbleGrid::set(const Cell & cell, Bubble* bubble)
+{
+	if (!isInside(cell))
+	{
+		return;
+	}
+
+	// The board owns the state, the bubble only mirrors it on screen
+	mBoard.place(cell, bubble->getPiece());
+
+	const std::size_t index = mBoard.getIndex(cell);
+	if (index >= mCells.size())
+	{
+		mCells.resize(mBoard.getCapacity(), nullptr);
+	}
+	mCells[index] = bubble;
+
+	// A new bubble starts still, at its own position
+	mShake.add(index, bubble->mPosition.x(), bubble->mPosition.y(), bubble->mPosition.z());
+}
+
+void BubbleGrid::remove(const Cell & cell, const Bubble* bubble)
+{
+	if (!isInside(cell))
+	{
+		return;
+	}
+
+	// Remove only if the cell was not taken by another bubble in the meantime
+	const std::size_t index = mBoard.getIndex(cell);
+	if (index < mCells.size() && mCells[index] == bubble)
+	{
+		mCells[index] = nullptr;
+		mBoard.remove(cell);
+		mShake.remove(index);
+	}
+}
+
+void BubbleGrid::clear()
+{
+	mCells.clear();
+	mBoard.clear();
+	mShake.clear();
+}
+
+const std::array<BubbleGrid::Cell, BUBBLE_GRID_NEIGHBOURS> BubbleGrid::getNeighbours(const Cell & cell) const
+{
+	return mBoard.getNeighbours(cell);
+}
+
+void BubbleGrid::applyRipple(const Vector3 & center)
+{
+	mShake.applyRipple(center.x(), center.y(), center.z());
+}
+
+void BubbleGrid::updateShake(const Float deltaTime)
+{
+	mShake.update(deltaTime);
+}
+
+const Vector2 BubbleGrid::getShakeOffset(const Cell & cell) const
+{
+	if (!isInside(cell))
+	{
+		return Vector2(0.0f);
+	}
+
+	Vector2 offset;
+	mShake.getOffset(mBoard.getIndex(cell), offset[0], offset[1]);
+	return offset;
+}
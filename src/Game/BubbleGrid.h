@@ -0,0 +1,107 @@
+#pragma once
+
+#define BUBBLE_GRID_NEIGHBOURS BOARD_NEIGHBOURS
+
+#include <array>
+#include <vector>
+#include <Magnum/Magnum.h>
+#include <Magnum/Math/Vector2.h>
+#include <Magnum/Math/Vector3.h>
+#include <Magnum/Math/Functions.h>
+
+#include "../Core/Board.h"
+#include "../Core/ShakeField.h"
+
+using namespace Magnum;
+
+class Bubble;
+
+/*
+	Bubbles of a level, laid out over the board of the core rules. The board
+	holds the state the rules work on, while this class maps every cell to
+	the bubble which draws it. Both share the same storage layout.
+*/
+class BubbleGrid
+{
+public:
+	// Cell coordinates
+	typedef BoardCell Cell;
+
+	// Conversion between world positions and cells
+	static Cell getCellByPosition(const Vector3 & position);
+	static Vector3 getPositionByCell(const Cell & cell, const Float z = 0.0f);
+
+	explicit BubbleGrid(const Int columns);
+
+	const Int getColumns() const;
+	const Int getRows() const;
+
+	Board & getBoard();
+
+	bool isInside(const Cell & cell) const;
+	Bubble* get(const Cell & cell) const;
+	void set(const Cell & cell, Bubble* bubble);
+	void remove(const Cell & cell, const Bubble* bubble);
+	void clear();
+
+	const std::array<Cell, BUBBLE_GRID_NEIGHBOURS> getNeighbours(const Cell & cell) const;
+
+	/*
+		Ripple animation of the bubbles, run in batch over the occupied cells. A
+		ripple shakes every bubble away from its center, the more the farther it
+		is; bubbles which would barely move keep their current shake. The shake
+		is moved forward once per step, and read back by each bubble as an offset.
+	*/
+	void applyRipple(const Vector3 & center);
+	void updateShake(const Float deltaTime);
+	const Vector2 getShakeOffset(const Cell & cell) const;
+
+	/*
+		Invoke callback for every occupied cell which may be touched by a circle
+		of the given radius, moving along the segment. Rows are visited starting
+		from the one nearest to "from". The callback returns false to stop.
+	*/
+	template <typename F>
+	void forEachAlongSegment(const Vector3 & from, const Vector3 & to, const Float radius, F && callback) const
+	{
+		mBoard.forEachAlongSegment(from.x(), from.y(), to.x(), to.y(), radius, [&](const Cell & cell, const BoardPiece &) {
+			Bubble* bubble = get(cell);
+			return bubble == nullptr || callback(bubble);
+		});
+	}
+
+	// Invoke callback for every bubble, in row-major order, until it returns false
+	template <typename F>
+	void forEachBubble(F && callback) const
+	{
+		for (Bubble* bubble : mCells)
+		{
+			if (bubble != nullptr && !callback(bubble))
+			{
+				return;
+			}
+		}
+	}
+
+	// Invoke callback for every occupied cell around the given one
+	template <typename F>
+	void forEachNeighbour(const Cell & cell, F && callback) const
+	{
+		for (const auto& n : getNeighbours(cell))
+		{
+			Bubble* bubble = get(n);
+			if (bubble != nullptr)
+			{
+				callback(bubble);
+			}
+		}
+	}
+
+protected:
+	Int mColumns;
+	Board mBoard;
+	std::vector<Bubble*> mCells;
+
+	// Animation state of the occupied cells only, keyed like the board
+	ShakeField mShake;
+};
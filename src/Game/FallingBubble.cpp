@@ -1,310 +1,348 @@
-#include "FallingBubble.h"	
-
-#include <thread>
-
-#include <Corrade/Containers/PointerStl.h>
-#include <Magnum/ImageView.h>
-#include <Magnum/GL/Buffer.h>
-#include <Magnum/Shaders/Flat.h>
-
-#include "../Common/CommonUtility.h"
-#include "../Graphics/GameDrawable.h"
-#include "../Shaders/SpriteShader.h"
-#include "../AssetManager.h"
-#include "../RoomManager.h"
-
-using namespace Magnum;
-using namespace Magnum::Math::Literals;
-
-std::shared_ptr<GameObject> FallingBubble::getInstance(const nlohmann::json & params)
-{
-	// No default constructor exists for this class!!
-	return nullptr;
-}
-
-FallingBubble::FallingBubble(const Int parentIndex, const Color3& ambientColor, const Int customType, const Float maxVerticalSpeed) : GameObject(parentIndex), mCustomType(customType)
-{
-	// Assign members
-	mParentIndex = parentIndex;
-	mAmbientColor = ambientColor;
-	mMaxVerticalSpeed = maxVerticalSpeed;
-
-	// Create sparkle plane
-	if (mCustomType == GO_FB_TYPE_BUBBLE || mCustomType == GO_FB_TYPE_BLACKHOLE)
-	{
-		// Init members
-		mVelocity = Vector3(0.0f);
-		mDelay = Float(std::rand() % 250) * 0.001f;
-
-		// Load assets
-		mFlatShader = CommonUtility::singleton->getFlat3DShader();
-		CommonUtility::singleton->createGameSphere(this, *mManipulator, mAmbientColor);
-	}
-	else if (mCustomType == GO_FB_TYPE_SPARK)
-	{
-		// Init members
-		mDelay = 0.0f;
-
-		// Load assets
-		{
-			Resource<GL::Mesh> resMesh = CommonUtility::singleton->getPlaneMeshForSpecializedShader<Shaders::Flat3D::Position, Shaders::Flat3D::TextureCoordinates>(RESOURCE_MESH_PLANE_FLAT);
-			Resource<GL::Texture2D> resTexture = CommonUtility::singleton->loadTexture(RESOURCE_TEXTURE_SPARKLE);
-			mFlatShader = CommonUtility::singleton->getFlat3DShader();
-
-			// Create drawable
-			auto& drawables = RoomManager::singleton->mGoLayers[mParentIndex].drawables;
-			std::shared_ptr<GameDrawable<Shaders::Flat3D>> d = std::make_shared<GameDrawable<Shaders::Flat3D>>(*drawables, mFlatShader, resMesh, resTexture);
-			d->setParent(&*mManipulator);
-			d->setDrawCallback(this);
-			mDrawables.emplace_back(d);
-		}
-	}
-	else if (mCustomType == GO_FB_TYPE_COIN)
-	{
-		// Init members
-		mVelocity = Vector3(0.0f);
-		mDelay = 0.0f;
-
-		// Load assets
-		AssetManager().loadAssets(*this, *mManipulator, RESOURCE_SCENE_COIN, this);
-	}
-	else if (mCustomType == GO_FB_TYPE_BOMB)
-	{
-		// Init members
-		mVelocity = Vector3(0.0f);
-		mDelay = 0.0f;
-
-		// Create assets
-		{
-			// Get sparkles texture
-			Resource<GL::Texture2D> resTexture = CommonUtility::singleton->loadTexture(RESOURCE_TEXTURE_EXPLOSION);
-
-			// Create plane
-			const std::shared_ptr<GameDrawable<SpriteShader>> td = std::static_pointer_cast<GameDrawable<SpriteShader>>(CommonUtility::singleton->createSpriteDrawable(mParentIndex, *mManipulator, resTexture, this));
-			mDrawables.emplace_back(td);
-
-			// Create shader data wrapper
-			mWrapper.shader = &td->getShader();
-			mWrapper.parameters.index = 0.0f;
-			mWrapper.parameters.total = 16.0f;
-			mWrapper.parameters.rows = 4.0f;
-			mWrapper.parameters.columns = 4.0f;
-			mWrapper.speed = 16.0f;
-		}
-	}
-	else if (mCustomType == GO_FB_TYPE_STONE)
-	{
-		// Init members
-		mVelocity = Vector3(0.0f);
-		mDelay = 0.0f;
-
-		// Load assets
-		AssetManager().loadAssets(*this, *mManipulator, RESOURCE_SCENE_STONE, this);
-	}
-}
-
-const Int FallingBubble::getType() const
-{
-	return GOT_FALLING_BUBBLE;
-}
-
-void FallingBubble::update()
-{
-	// Update motion
-	switch (mCustomType)
-	{
-	case GO_FB_TYPE_BUBBLE:
-	case GO_FB_TYPE_STONE:
-	case GO_FB_TYPE_BLACKHOLE:
-
-		// Advance falling animation
-		if (mDelay > 0.0f)
-		{
-			mDelay -= mDeltaTime;
-		}
-		else
-		{
-			// Play sound
-			playPrimarySound();
-
-			// Raise velocity
-			if (mVelocity.y() > mMaxVerticalSpeed)
-			{
-				mVelocity += { 0.0f, -100.0f * mDeltaTime, 0.0f };
-			}
-			mPosition += mVelocity * mDeltaTime;
-		}
-
-		// Check for off-screen position
-		if (mPosition.y() < -100.0f)
-		{
-			mDestroyMe = true;
-		}
-
-		// Apply transformations
-		(*mManipulator)
-			.resetTransformation()
-			.translate(mPosition);
-
-		break;
-
-	case GO_FB_TYPE_COIN:
-
-		// Play sound
-		playPrimarySound();
-
-		// Update position
-		{
-			auto& p = mVelocity.data()[0];
-			p += -p * mDeltaTime;
-
-			if (p > 0.0f)
-			{
-				p = 0.0f;
-			}
-		}
-
-		mPosition += mVelocity * mDeltaTime;
-
-		// Control life-time
-		if (mPosition.y() > 20.0f)
-		{
-			mDestroyMe = true;
-		}
-
-		// Apply transformations
-		mDelay += Constants::pi() * mDeltaTime;
-
-		(*mManipulator)
-			.resetTransformation()
-			.rotateX(Rad(Deg(90.0f)))
-			.rotateY(Rad(mDelay))
-			.translate(mPosition);
-
-		break;
-
-	case GO_FB_TYPE_SPARK:
-
-		mDelay += mDeltaTime;
-		if (mDelay >= 1.0f)
-		{
-			mDelay = 1.0f;
-			mDestroyMe = true;
-		}
-
-		(*mManipulator)
-			.resetTransformation()
-			.rotateZ(Deg(mDelay * 210.0f))
-			.scale(Vector3(Math::sin(Deg(mDelay * 180.0f)) * 2.0f))
-			.translate(mPosition + Vector3(0.0f, 0.0f, 0.05f));
-
-		break;
-
-	case GO_FB_TYPE_BOMB:
-
-		playPrimarySound();
-		checkForSpriteEnding();
-
-		(*mManipulator)
-			.resetTransformation()
-			.scale(Vector3(8.0f, 8.0f, 1.0f))
-			.translate(mPosition + Vector3(0.0f, 0.0f, 0.75f));
-
-		break;
-	}
-}
-
-void FallingBubble::draw(BaseDrawable* baseDrawable, const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera)
-{
-	const bool isWhite = mCustomType == GO_FB_TYPE_BUBBLE || mCustomType == GO_FB_TYPE_BLACKHOLE;
-	if (isWhite || mCustomType == GO_FB_TYPE_SPARK)
-	{
-		((Shaders::Flat3D&)*mFlatShader)
-			.setTransformationProjectionMatrix(camera.projectionMatrix() * transformationMatrix)
-			.bindTexture(*baseDrawable->mTexture)
-			.setColor(isWhite ? 0xffffffff_rgbaf : mAmbientColor)
-			.setAlphaMask(0.5f)
-			.draw(*baseDrawable->mMesh);
-	}
-	else if (mCustomType == GO_FB_TYPE_BOMB)
-	{
-		((SpriteShader&)baseDrawable->getShader())
-			.bindTexture(*baseDrawable->mTexture)
-			.setTransformationProjectionMatrix(camera.projectionMatrix() * transformationMatrix)
-			.setColor(mAmbientColor)
-			.setIndex(mWrapper.parameters.index)
-			.setRows(mWrapper.parameters.rows)
-			.setColumns(mWrapper.parameters.columns)
-			.setAlphaMask(0.5f)
-			.draw(*baseDrawable->mMesh);
-	}
-	else
-	{
-		((Shaders::Phong&) baseDrawable->getShader())
-			.setLightPosition(mPosition + Vector3(0.0f, 0.0f, 1.0f))
-			.setLightColor(0x808080_rgbf)
-			.setSpecularColor(0xffffff00_rgbaf)
-			.setAmbientColor(0xc0c0c0_rgbf)
-			.setDiffuseColor(0x808080_rgbf)
-			.setTransformationMatrix(transformationMatrix)
-			.setNormalMatrix(transformationMatrix.normalMatrix())
-			.setProjectionMatrix(camera.projectionMatrix())
-			.bindTextures(baseDrawable->mTexture, baseDrawable->mTexture, nullptr, nullptr)
-			.draw(*baseDrawable->mMesh);
-	}
-}
-
-std::shared_ptr<Audio::Playable3D>& FallingBubble::buildSound()
-{
-	std::string filename;
-	switch (mCustomType)
-	{
-	case GO_FB_TYPE_BUBBLE:
-	case GO_FB_TYPE_BLACKHOLE:
-		filename = RESOURCE_AUDIO_BUBBLE_FALL;
-		break;
-
-	case GO_FB_TYPE_SPARK:
-		filename = RESOURCE_AUDIO_BUBBLE_POP;
-		break;
-
-	case GO_FB_TYPE_COIN:
-		filename = RESOURCE_AUDIO_COIN;
-		break;
-
-	case GO_FB_TYPE_BOMB:
-		filename = RESOURCE_AUDIO_EXPLOSION;
-		break;
-
-	case GO_FB_TYPE_STONE:
-		filename = RESOURCE_AUDIO_STONE;
-		break;
-	}
-
-	Resource<Audio::Buffer> buffer = CommonUtility::singleton->loadAudioData(filename);
-	mPlayables[0] = std::make_shared<Audio::Playable3D>(*mManipulator, &RoomManager::singleton->mAudioPlayables);
-	mPlayables[0]->source()
-		.setBuffer(buffer)
-		.setLooping(false);
-	return mPlayables[0];
-}
-
-void FallingBubble::checkForSpriteEnding()
-{
-	if (mWrapper.parameters.index >= mWrapper.parameters.total - 0.5f)
-	{
-		mDestroyMe = true;
-	}
-	else
-	{
-		mWrapper.parameters.index += mDeltaTime * mWrapper.speed;
-	}
-}
-
-void FallingBubble::playPrimarySound()
-{
-	if (mPlayables.size() > 0 && mPlayables[0]->source().state() == Audio::Source::State::Initial)
-	{
-		playSfxAudio(0);
-	}
+#include "FallingBubble.h"	
+
+#include <thread>
+
+#include <Corrade/Containers/PointerStl.h>
+#include <Magnum/ImageView.h>
+#include <Magnum/GL/Buffer.h>
+#include <Magnum/Shaders/Flat.h>
+
+#include "../Common/CommonUtility.h"
+#include "../Graphics/GameDrawable.h"
+#include "../Shaders/SpriteShader.h"
+#include "../AssetManager.h"
+#include "../RandomManager.h"
+#include "../RoomManager.h"
+
+using namespace Magnum;
+using namespace Magnum::Math::Literals;
+
+std::shared_ptr<GameObject> FallingBubble::getInstance(const nlohmann::json & params)
+{
+	// No default constructor exists for this class!!
+	return nullptr;
+}
+
+FallingBubble::FallingBubble(const Int parentIndex, const Color3& ambientColor, const Int customType, const Float maxVerticalSpeed) : GameObject(parentIndex), mCustomType(customType)
+{
+	// Assign members
+	mParentIndex = parentIndex;
+	mAmbientColor = ambientColor;
+	mMaxVerticalSpeed = maxVerticalSpeed;
+	resetState();
+
+	// Create sparkle plane
+	if (mCustomType == GO_FB_TYPE_BUBBLE || mCustomType == GO_FB_TYPE_BLACKHOLE)
+	{
+		// Load assets
+		mFlatShader = CommonUtility::singleton->getFlat3DShader();
+		CommonUtility::singleton->createGameSphere(this, *mManipulator, mAmbientColor);
+	}
+	else if (mCustomType == GO_FB_TYPE_SPARK)
+	{
+		// Load assets
+		{
+			Resource<GL::Mesh> resMesh = CommonUtility::singleton->getPlaneMeshForSpecializedShader<Shaders::Flat3D::Position, Shaders::Flat3D::TextureCoordinates>(RESOURCE_MESH_PLANE_FLAT);
+			Resource<GL::Texture2D> resTexture = CommonUtility::singleton->loadTexture(RESOURCE_TEXTURE_SPARKLE);
+			mFlatShader = CommonUtility::singleton->getFlat3DShader();
+
+			// Create drawable
+			auto& drawables = RoomManager::singleton->mGoLayers[mParentIndex].drawables;
+			std::shared_ptr<GameDrawable<Shaders::Flat3D>> d = std::make_shared<GameDrawable<Shaders::Flat3D>>(*drawables, mFlatShader, resMesh, resTexture);
+			d->setParent(&*mManipulator);
+			d->setDrawCallback(this);
+			mDrawables.emplace_back(d);
+		}
+	}
+	else if (mCustomType == GO_FB_TYPE_COIN)
+	{
+		// Load assets
+		AssetManager().loadAssets(*this, *mManipulator, RESOURCE_SCENE_COIN, this);
+	}
+	else if (mCustomType == GO_FB_TYPE_BOMB)
+	{
+		// Create assets
+		{
+			// Get sparkles texture
+			Resource<GL::Texture2D> resTexture = CommonUtility::singleton->loadTexture(RESOURCE_TEXTURE_EXPLOSION);
+
+			// Create plane
+			const std::shared_ptr<GameDrawable<SpriteShader>> td = std::static_pointer_cast<GameDrawable<SpriteShader>>(CommonUtility::singleton->createSpriteDrawable(mParentIndex, *mManipulator, resTexture, this));
+			mDrawables.emplace_back(td);
+
+			// Create shader data wrapper
+			mWrapper.shader = &td->getShader();
+			mWrapper.parameters.total = 16.0f;
+			mWrapper.parameters.rows = 4.0f;
+			mWrapper.parameters.columns = 4.0f;
+			mWrapper.speed = 16.0f;
+		}
+	}
+	else if (mCustomType == GO_FB_TYPE_STONE)
+	{
+		// Load assets
+		AssetManager().loadAssets(*this, *mManipulator, RESOURCE_SCENE_STONE, this);
+	}
+}
+
+void FallingBubble::resetState()
+{
+	mDestroyMe = false;
+	mPreviousPosition = Containers::NullOpt;
+	mVelocity = Vector3(0.0f);
+	mWrapper.parameters.index = 0.0f;
+
+	// Falling bubbles don't start all together
+	const bool isFalling = mCustomType == GO_FB_TYPE_BUBBLE || mCustomType == GO_FB_TYPE_BLACKHOLE;
+	mDelay = isFalling ? Float(RandomManager::singleton->next(RNG_STREAM_EFFECTS, 250)) * 0.001f : 0.0f;
+}
+
+void FallingBubble::park()
+{
+	// Hide from the layer, which may not exist anymore
+	for (const auto& d : mDrawables)
+	{
+		auto* p = d->group();
+		if (p != nullptr)
+		{
+			p->remove(*d);
+		}
+	}
+
+	// Release the sound source, since only a few can exist at once; the buffer is kept for the next use
+	mPlayables.erase(0);
+}
+
+void FallingBubble::reuse(const Color3& ambientColor, const Float maxVerticalSpeed)
+{
+	// Bubbles are the only effects whose assets depend on the color
+	const bool isWhite = mCustomType == GO_FB_TYPE_BUBBLE || mCustomType == GO_FB_TYPE_BLACKHOLE;
+	if (isWhite && ambientColor != mAmbientColor)
+	{
+		mDrawables.back()->mTexture = CommonUtility::singleton->getTextureForBubble(ambientColor);
+	}
+
+	mAmbientColor = ambientColor;
+	mMaxVerticalSpeed = maxVerticalSpeed;
+	resetState();
+
+	// Show again on its layer, starting from the origin like a new object
+	auto& drawables = RoomManager::singleton->mGoLayers[mParentIndex].drawables;
+	for (const auto& d : mDrawables)
+	{
+		drawables->add(*d);
+	}
+	mManipulator->resetTransformation();
+}
+
+const Int FallingBubble::getType() const
+{
+	return GOT_FALLING_BUBBLE;
+}
+
+void FallingBubble::update()
+{
+	// Update motion
+	switch (mCustomType)
+	{
+	case GO_FB_TYPE_BUBBLE:
+	case GO_FB_TYPE_STONE:
+	case GO_FB_TYPE_BLACKHOLE:
+
+		// Advance falling animation
+		if (mDelay > 0.0f)
+		{
+			mDelay -= mDeltaTime;
+		}
+		else
+		{
+			// Play sound
+			playPrimarySound();
+
+			// Raise velocity
+			if (mVelocity.y() > mMaxVerticalSpeed)
+			{
+				mVelocity += { 0.0f, -100.0f * mDeltaTime, 0.0f };
+			}
+			mPosition += mVelocity * mDeltaTime;
+		}
+
+		// Check for off-screen position
+		if (mPosition.y() < -100.0f)
+		{
+			mDestroyMe = true;
+		}
+
+		// Apply transformations
+		(*mManipulator)
+			.resetTransformation()
+			.translate(mPosition);
+
+		break;
+
+	case GO_FB_TYPE_COIN:
+
+		// Play sound
+		playPrimarySound();
+
+		// Update position
+		{
+			auto& p = mVelocity.data()[0];
+			p += -p * mDeltaTime;
+
+			if (p > 0.0f)
+			{
+				p = 0.0f;
+			}
+		}
+
+		mPosition += mVelocity * mDeltaTime;
+
+		// Control life-time
+		if (mPosition.y() > 20.0f)
+		{
+			mDestroyMe = true;
+		}
+
+		// Apply transformations
+		mDelay += Constants::pi() * mDeltaTime;
+
+		(*mManipulator)
+			.resetTransformation()
+			.rotateX(Rad(Deg(90.0f)))
+			.rotateY(Rad(mDelay))
+			.translate(mPosition);
+
+		break;
+
+	case GO_FB_TYPE_SPARK:
+
+		mDelay += mDeltaTime;
+		if (mDelay >= 1.0f)
+		{
+			mDelay = 1.0f;
+			mDestroyMe = true;
+		}
+
+		(*mManipulator)
+			.resetTransformation()
+			.rotateZ(Deg(mDelay * 210.0f))
+			.scale(Vector3(Math::sin(Deg(mDelay * 180.0f)) * 2.0f))
+			.translate(mPosition + Vector3(0.0f, 0.0f, 0.05f));
+
+		break;
+
+	case GO_FB_TYPE_BOMB:
+
+		playPrimarySound();
+		checkForSpriteEnding();
+
+		(*mManipulator)
+			.resetTransformation()
+			.scale(Vector3(8.0f, 8.0f, 1.0f))
+			.translate(mPosition + Vector3(0.0f, 0.0f, 0.75f));
+
+		break;
+	}
+}
+
+void FallingBubble::draw(BaseDrawable* baseDrawable, const Matrix4& stepTransformationMatrix, SceneGraph::Camera3D& camera)
+{
+	const Matrix4 transformationMatrix = getInterpolatedTransformation(stepTransformationMatrix, camera);
+	const bool isWhite = mCustomType == GO_FB_TYPE_BUBBLE || mCustomType == GO_FB_TYPE_BLACKHOLE;
+	if (isWhite || mCustomType == GO_FB_TYPE_SPARK)
+	{
+		((Shaders::Flat3D&)*mFlatShader)
+			.setTransformationProjectionMatrix(camera.projectionMatrix() * transformationMatrix)
+			.bindTexture(*baseDrawable->mTexture)
+			.setColor(isWhite ? 0xffffffff_rgbaf : mAmbientColor)
+			.setAlphaMask(0.5f)
+			.draw(*baseDrawable->mMesh);
+	}
+	else if (mCustomType == GO_FB_TYPE_BOMB)
+	{
+		((SpriteShader&)baseDrawable->getShader())
+			.bindTexture(*baseDrawable->mTexture)
+			.setTransformationProjectionMatrix(camera.projectionMatrix() * transformationMatrix)
+			.setColor(mAmbientColor)
+			.setIndex(mWrapper.parameters.index)
+			.setRows(mWrapper.parameters.rows)
+			.setColumns(mWrapper.parameters.columns)
+			.setAlphaMask(0.5f)
+			.draw(*baseDrawable->mMesh);
+	}
+	else
+	{
+		((Shaders::Phong&) baseDrawable->getShader())
+			.setLightPosition(mPosition + Vector3(0.0f, 0.0f, 1.0f))
+			.setLightColor(0x808080_rgbf)
+			.setSpecularColor(0xffffff00_rgbaf)
+			.setAmbientColor(0xc0c0c0_rgbf)
+			.setDiffuseColor(0x808080_rgbf)
+			.setTransformationMatrix(transformationMatrix)
+			.setNormalMatrix(transformationMatrix.normalMatrix())
+			.setProjectionMatrix(camera.projectionMatrix())
+			.bindTextures(baseDrawable->mTexture, baseDrawable->mTexture, nullptr, nullptr)
+			.draw(*baseDrawable->mMesh);
+	}
+}
+
+std::shared_ptr<Audio::Playable3D>& FallingBubble::buildSound()
+{
+	std::string filename;
+	switch (mCustomType)
+	{
+	case GO_FB_TYPE_BUBBLE:
+	case GO_FB_TYPE_BLACKHOLE:
+		filename = RESOURCE_AUDIO_BUBBLE_FALL;
+		break;
+
+	case GO_FB_TYPE_SPARK:
+		filename = RESOURCE_AUDIO_BUBBLE_POP;
+		break;
+
+	case GO_FB_TYPE_COIN:
+		filename = RESOURCE_AUDIO_COIN;
+		break;
+
+	case GO_FB_TYPE_BOMB:
+		filename = RESOURCE_AUDIO_EXPLOSION;
+		break;
+
+	case GO_FB_TYPE_STONE:
+		filename = RESOURCE_AUDIO_STONE;
+		break;
+	}
+
+	// Pooled effects look the buffer up once, then only get a new source
+	if (mSoundBuffer == Containers::NullOpt)
+	{
+		mSoundBuffer = CommonUtility::singleton->loadAudioData(filename);
+	}
+
+	mPlayables[0] = std::make_shared<Audio::Playable3D>(*mManipulator, &RoomManager::singleton->mAudioPlayables);
+	mPlayables[0]->source()
+		.setBuffer(*mSoundBuffer)
+		.setLooping(false);
+	return mPlayables[0];
+}
+
+void FallingBubble::checkForSpriteEnding()
+{
+	if (mWrapper.parameters.index >= mWrapper.parameters.total - 0.5f)
+	{
+		mDestroyMe = true;
+	}
+	else
+	{
+		mWrapper.parameters.index += mDeltaTime * mWrapper.speed;
+	}
+}
+
+void FallingBubble::playPrimarySound()
+{
+	if (mPlayables.size() > 0 && mPlayables[0]->source().state() == Audio::Source::State::Initial)
+	{
+		playSfxAudio(0);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "FallingBubblePool.h"
+
+#include <Magnum/Math/Functions.h>
+
+FallingBubblePool::FallingBubblePool(const UnsignedInt budget) : mBudget(budget)
+{
+}
+
+FallingBubblePool::~FallingBubblePool()
+{
+	clear();
+}
+
+void FallingBubblePool::setBudget(const UnsignedInt budget)
+{
+	mBudget = budget;
+}
+
+void FallingBubblePool::reserve(const Int parentIndex, const Int customType, const Color3 & ambientColor, const UnsignedInt count)
+{
+	auto& entries = mEntries[Key(parentIndex, customType)];
+	while (entries.size() < Math::min(count, mBudget))
+	{
+		const std::shared_ptr<FallingBubble> fb = std::make_shared<FallingBubble>(parentIndex, ambientColor, customType);
+		fb->park();
+		entries.push_back({ fb, false });
+	}
+}
+
+std::shared_ptr<FallingBubble> FallingBubblePool::acquire(const Int parentIndex, const Color3 & ambientColor, const Int customType, const Float maxVerticalSpeed)
+{
+	auto& entries = mEntries[Key(parentIndex, customType)];
+	for (auto& entry : entries)
+	{
+		if (!entry.lent)
+		{
+			entry.lent = true;
+			entry.fb->reuse(ambientColor, maxVerticalSpeed);
+			return entry.fb;
+		}
+	}
+
+	// Effects past the budget are not tracked, and die with their last reference
+	const std::shared_ptr<FallingBubble> fb = std::make_shared<FallingBubble>(parentIndex, ambientColor, customType, maxVerticalSpeed);
+	if (entries.size() < mBudget)
+	{
+		entries.push_back({ fb, true });
+	}
+	return fb;
+}
+
+void FallingBubblePool::collect()
+{
+	for (auto& it : mEntries)
+	{
+		auto& entries = it.second;
+		for (std::size_t i = 0; i < entries.size(); )
+		{
+			Entry& entry = entries[i];
+			if (!entry.lent || entry.fb.use_count() > 1)
+			{
+				++i;
+				continue;
+			}
+
+			// Budget may have shrunk since the effect was lent
+			if (entries.size() > mBudget)
+			{
+				entry = std::move(entries.back());
+				entries.pop_back();
+				continue;
+			}
+
+			entry.fb->park();
+			entry.lent = false;
+			++i;
+		}
+	}
+}
+
+void FallingBubblePool::clear()
+{
+	mEntries.clear();
+}
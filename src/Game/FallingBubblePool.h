@@ -0,0 +1,58 @@
+#pragma once
+
+#define FALLING_BUBBLE_POOL_BUDGET 64U
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <Magnum/Magnum.h>
+#include <Magnum/Math/Color.h>
+
+#include "FallingBubble.h"
+
+using namespace Magnum;
+
+/*
+	Falling bubbles, sparks, coins and explosions waiting to be shown again.
+	Effects are acquired from here instead of being constructed. The pool
+	keeps its own reference to each of them, so handing one out copies a
+	pointer which already exists, and an effect is idle again once the pool
+	holds its only reference. Idle effects are parked by "collect", with
+	their assets still loaded. Up to a budget of effects is kept for every
+	layer and type; extra effects are destroyed when released.
+	Every method must be called from the main thread.
+*/
+class FallingBubblePool
+{
+public:
+	explicit FallingBubblePool(const UnsignedInt budget = FALLING_BUBBLE_POOL_BUDGET);
+	~FallingBubblePool();
+
+	// Maximum amount of effects kept for every layer and type
+	void setBudget(const UnsignedInt budget);
+
+	// Build effects in advance, so the first shots don't have to
+	void reserve(const Int parentIndex, const Int customType, const Color3 & ambientColor, const UnsignedInt count);
+
+	// Effect ready to be added to its layer, reused when possible
+	std::shared_ptr<FallingBubble> acquire(const Int parentIndex, const Color3 & ambientColor, const Int customType, const Float maxVerticalSpeed = -100.0f);
+
+	// Park the effects released since last call. Must run before drawing, once they left their layer
+	void collect();
+
+	// Forget all the effects. Those still in a layer are destroyed when released
+	void clear();
+
+protected:
+	typedef std::pair<Int, Int> Key;
+
+	struct Entry
+	{
+		std::shared_ptr<FallingBubble> fb;
+		bool lent;
+	};
+
+	UnsignedInt mBudget;
+	std::map<Key, std::vector<Entry>> mEntries;
+};
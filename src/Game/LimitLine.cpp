@@ -1,67 +1,79 @@
-#include "LimitLine.h"
-
-#include <Magnum/Shaders/Flat.h>
-
-#include "../RoomManager.h"
-#include "../Common/CommonUtility.h"
-
-std::shared_ptr<GameObject> LimitLine::getInstance(const nlohmann::json & params)
-{
-	// No default constructor exists for this class!!
-	return nullptr;
-}
-
-LimitLine::LimitLine(const Int parentIndex, const Color4 & color, const Int customType) : GameObject(parentIndex)
-{
-	// Assign members
-	mParentIndex = parentIndex;
-	mColor = color;
-	mCustomType = customType;
-
-	// Get assets
-	Resource<GL::Mesh> mesh = CommonUtility::singleton->getPlaneMeshForSpecializedShader<Shaders::Flat3D::Position, Shaders::Flat3D::TextureCoordinates>(RESOURCE_MESH_PLANE_FLAT);
-	Resource<GL::AbstractShaderProgram, Shaders::Flat3D> shader = CommonUtility::singleton->getFlat3DShader();
-	Resource<GL::Texture2D> texture = CommonUtility::singleton->loadTexture(RESOURCE_TEXTURE_WHITE);
-
-	// Create drawable
-	auto& drawables = RoomManager::singleton->mGoLayers[parentIndex].drawables;
-
-	const std::shared_ptr<GameDrawable<Shaders::Flat3D>> td = std::make_shared<GameDrawable<Shaders::Flat3D>>(*drawables, shader, mesh, mColor);
-	td->mTexture = texture;
-	td->setParent(mManipulator);
-	td->setDrawCallback(this);
-	mDrawables.emplace_back(td);
-}
-
-const Int LimitLine::getType() const
-{
-	return GOT_LIMIT_LINE;
-}
-
-void LimitLine::update()
-{
-	(*mManipulator)
-		.resetTransformation()
-		.scale(mScale)
-		.translate(Vector3(mPosition));
-}
-
-void LimitLine::draw(BaseDrawable* baseDrawable, const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera)
-{
-	((Shaders::Flat3D&) baseDrawable->getShader())
-		.setTransformationProjectionMatrix(camera.projectionMatrix() * transformationMatrix)
-		.setColor(baseDrawable->mColor)
-		.setAlphaMask(0.1f)
-		.bindTexture(*baseDrawable->mTexture)
-		.draw(*baseDrawable->mMesh);
-}
-
-const Int LimitLine::getCustomType() const
-{
-	return mCustomType;
-}
-
-const void LimitLine::setScale(const Vector3 & scale)
-{
-	mScale = scale;
+#include "LimitLine.h"
+
+#include <Magnum/Math/Functions.h>
+#include <Magnum/Shaders/Flat.h>
+
+#include "../RoomManager.h"
+#include "../Common/CommonUtility.h"
+
+std::shared_ptr<GameObject> LimitLine::getInstance(const nlohmann::json & params)
+{
+	// No default constructor exists for this class!!
+	return nullptr;
+}
+
+LimitLine::LimitLine(const Int parentIndex, const Color4 & color, const Int customType) : GameObject(parentIndex)
+{
+	// Assign members
+	mParentIndex = parentIndex;
+	mColor = color;
+	mCustomType = customType;
+	mDangerSpeed = 0.0f;
+	mDangerAnim = 0.0f;
+
+	// Get assets
+	Resource<GL::Mesh> mesh = CommonUtility::singleton->getPlaneMeshForSpecializedShader<Shaders::Flat3D::Position, Shaders::Flat3D::TextureCoordinates>(RESOURCE_MESH_PLANE_FLAT);
+	Resource<GL::AbstractShaderProgram, Shaders::Flat3D> shader = CommonUtility::singleton->getFlat3DShader();
+	Resource<GL::Texture2D> texture = CommonUtility::singleton->loadTexture(RESOURCE_TEXTURE_WHITE);
+
+	// Create drawable
+	auto& drawables = RoomManager::singleton->mGoLayers[parentIndex].drawables;
+
+	const std::shared_ptr<GameDrawable<Shaders::Flat3D>> td = std::make_shared<GameDrawable<Shaders::Flat3D>>(*drawables, shader, mesh, mColor);
+	td->mTexture = texture;
+	td->setParent(mManipulator);
+	td->setDrawCallback(this);
+	mDrawables.emplace_back(td);
+}
+
+const Int LimitLine::getType() const
+{
+	return GOT_LIMIT_LINE;
+}
+
+void LimitLine::update()
+{
+	// Advance blinking animation
+	mDangerAnim = mDangerSpeed > 0.0f ? mDangerAnim + mDeltaTime * mDangerSpeed : 0.0f;
+
+	(*mManipulator)
+		.resetTransformation()
+		.scale(mScale)
+		.translate(Vector3(mPosition));
+}
+
+void LimitLine::draw(BaseDrawable* baseDrawable, const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera)
+{
+	((Shaders::Flat3D&) baseDrawable->getShader())
+		.setTransformationProjectionMatrix(camera.projectionMatrix() * transformationMatrix)
+		.setColor(Math::lerp(baseDrawable->mColor, Color4(1.0f), (0.5f - 0.5f * Math::cos(Rad(mDangerAnim))) * 0.6f))
+		.setAlphaMask(0.1f)
+		.bindTexture(*baseDrawable->mTexture)
+		.draw(*baseDrawable->mMesh);
+}
+
+const Int LimitLine::getCustomType() const
+{
+	return mCustomType;
+}
+
+const void LimitLine::setScale(const Vector3 & scale)
+{
+	mScale = scale;
+}
+
+const void LimitLine::setDanger(const bool danger, const Int rowsLeft)
+{
+	// Blink faster as the bubbles get closer
+	mDangerSpeed = danger ? 4.0f + 4.0f * Float(BOARD_RULES_DANGER_ROWS - Math::max(rowsLeft, 0)) : 0.0f;
 }
\ No newline at end of file
@@ -1,58 +1,59 @@
-#pragma once
-
-#define IMPOSSIBLE_PROJECTILE_XPOS -100.0f
-
-#include <nlohmann/json.hpp>
-#include <Magnum/Math/Color.h>
-#include <Magnum/Shaders/Flat.h>
-
-#include "../GameObject.h"
-#include "../Game/Callbacks/IShootCallback.h"
-#include "../Game/ElectricBall.h"
-#include "../Graphics/GameDrawable.h"
-
-class Projectile : public GameObject
-{
-public:
-	static void setGlobalParameters(const Float leftX, const Float rightX);
-
-	static Float LEFT_X, RIGHT_X, MID_X;
-
-	static std::shared_ptr<GameObject> getInstance(const nlohmann::json & params);
-
-	Projectile(const Int parentIndex, const Color3& ambientColor);
-	~Projectile();
-
-	const Int getType() const override;
-	void update() override;
-	void draw(BaseDrawable* baseDrawable, const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) override;
-
-	void collidedWith(const std::unique_ptr<std::unordered_set<GameObject*>> & gameObjects);
-	void adjustPosition();
-	void setCustomTexture(GL::Texture2D & texture);
-
-	// Class members
-	Color3 mAmbientColor;
-	Vector3 mVelocity;
-
-	// Optionals
-	std::weak_ptr<IShootCallback> mShootCallback;
-
-protected:
-	void snapToGrid(const std::unique_ptr<std::unordered_set<GameObject*>> & gameObjects);
-	void updateBBox();
-
-	const Int getRowIndexByBubble() const;
-	const Float getSnappedYPos() const;
-	const Float getRadiusForExplosion() const;
-	const void playStompSound();
-
-	std::shared_ptr<ElectricBall> mElectricBall;
-
-	Color3 mDiffuseColor;
-	GL::Texture2D* mCustomTexture;
-	Resource<GL::AbstractShaderProgram, Shaders::Flat3D> mFlatShader;
-
-	Float mSpeed;
-	Float mAnimation;
-};
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <Magnum/Math/Color.h>
+#include <Magnum/Shaders/Flat.h>
+
+#include "../GameObject.h"
+#include "../Game/Callbacks/IShootCallback.h"
+#include "../Game/ElectricBall.h"
+#include "../Graphics/GameDrawable.h"
+#include "../Core/BoardTypes.h"
+#include "../Core/ProjectileMotion.h"
+
+class Projectile : public GameObject
+{
+public:
+	static void setGlobalParameters(const Float leftX, const Float rightX);
+
+	static Float LEFT_X, RIGHT_X, MID_X;
+
+	static std::shared_ptr<GameObject> getInstance(const nlohmann::json & params);
+
+	Projectile(const Int parentIndex, const Color3& ambientColor);
+	~Projectile();
+
+	const Int getType() const override;
+	void update() override;
+	void draw(BaseDrawable* baseDrawable, const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) override;
+
+	void setCustomTexture(GL::Texture2D & texture);
+
+	// Class members
+	Color3 mAmbientColor;
+	Vector3 mVelocity;
+
+	// Optionals
+	std::weak_ptr<IShootCallback> mShootCallback;
+
+protected:
+	void snapToGrid();
+	void updateBBox();
+
+	const void playStompSound();
+
+	std::shared_ptr<ElectricBall> mElectricBall;
+
+	Color3 mDiffuseColor;
+	GL::Texture2D* mCustomTexture;
+	Resource<GL::AbstractShaderProgram, Shaders::Flat3D> mFlatShader;
+
+	Float mSpeed;
+	Float mAnimation;
+
+	// Time not simulated yet, as the motion runs in fixed steps
+	Float mPendingTime;
+
+	// Cells touched at the time of impact, reused across shots
+	std::vector<BoardCell> mTouched;
+};
@@ -1,56 +1,68 @@
-#include "GameObject.h"
-#include "RoomManager.h"
-
-GameObject::GameObject() : IDrawCallback()
-{
-	// Init members
-	mDestroyMe = false;
-	mDeltaTime = 0.0f;
-
-	// Create manipulator
-	mManipulator = new Object3D{ &RoomManager::singleton->mScene };
-}
-
-GameObject::GameObject(const Int parentIndex) : GameObject()
-{
-	mParentIndex = parentIndex;
-}
-
-GameObject::~GameObject()
-{
-	// Remove all drawables from its layer
-	for (const auto& d : mDrawables)
-	{
-		auto* p = d->group();
-		if (p != nullptr)
-		{
-			p->remove(*d);
-		}
-	}
-
-	// Clear references
-	mDrawables.clear();
-	mPlayables.clear();
-
-	// De-reference manipulator
-	mManipulator->parent()->erase(mManipulator);
-	mManipulator = nullptr;
-}
-
-const void GameObject::playSfxAudio(const Int index, const Float offset)
-{
-	const Float level = RoomManager::singleton->getSfxGain();
-	(*mPlayables[index])
-		.setGain(level)
-		.source()
-			.setOffsetInSeconds(offset)
-			.play();
-}
-
-const void GameObject::pushToFront()
-{
-	for (auto i = 0; i < mDrawables.size(); ++i)
-	{
-		mDrawables[i]->pushToFront();
-	}
-}
\ No newline at end of file
+#include "GameObject.h"
+#include "RoomManager.h"
+
+GameObject::GameObject() : IDrawCallback()
+{
+	// Init members
+	mDestroyMe = false;
+	mDeltaTime = 0.0f;
+
+	// Create manipulator
+	mManipulator = new Object3D{ &RoomManager::singleton->mScene };
+}
+
+GameObject::GameObject(const Int parentIndex) : GameObject()
+{
+	mParentIndex = parentIndex;
+}
+
+GameObject::~GameObject()
+{
+	// Remove all drawables from its layer
+	for (const auto& d : mDrawables)
+	{
+		auto* p = d->group();
+		if (p != nullptr)
+		{
+			p->remove(*d);
+		}
+	}
+
+	// Clear references
+	mDrawables.clear();
+	mPlayables.clear();
+
+	// De-reference manipulator
+	mManipulator->parent()->erase(mManipulator);
+	mManipulator = nullptr;
+}
+
+const void GameObject::playSfxAudio(const Int index, const Float offset)
+{
+	const Float level = RoomManager::singleton->getSfxGain();
+	(*mPlayables[index])
+		.setGain(level)
+		.source()
+			.setOffsetInSeconds(offset)
+			.play();
+}
+
+const void GameObject::pushToFront()
+{
+	for (auto i = 0; i < mDrawables.size(); ++i)
+	{
+		mDrawables[i]->pushToFront();
+	}
+}
+
+const Matrix4 GameObject::getInterpolatedTransformation(const Matrix4 & transformationMatrix, SceneGraph::Camera3D & camera) const
+{
+	if (mPreviousPosition == Containers::NullOpt)
+	{
+		return transformationMatrix;
+	}
+
+	// Move back towards the previous position by the part of the step which did not elapse yet
+	const Vector3 offset = (*mPreviousPosition - mPosition) * (1.0f - RoomManager::singleton->mFrameInterpolation);
+	return Matrix4::translation(camera.cameraMatrix().transformVector(offset)) * transformationMatrix;
+}
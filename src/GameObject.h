@@ -1,47 +1,65 @@
-#pragma once
-
-#include <vector>
-#include <memory>
-#include <unordered_set>
-
-#include <Magnum/Audio/Audio.h>
-#include <Magnum/Audio/Buffer.h>
-#include <Magnum/Audio/Playable.h>
-#include <Magnum/Audio/Source.h>
-#include <Magnum/Trade/MeshData.h>
-#include <Magnum/Math/Matrix4.h>
-#include <Magnum/Math/Range.h>
-#include <Magnum/SceneGraph/Camera.h>
-#include <Magnum/SceneGraph/Drawable.h>
-#include <Magnum/SceneGraph/MatrixTransformation3D.h>
-#include <Magnum/SceneGraph/Scene.h>
-
-#include "Common/CommonTypes.h"
-#include "Graphics/BaseDrawable.h"
-
-using namespace Magnum;
-
-class GameObject : public IDrawCallback
-{
-public:
-	GameObject();
-	GameObject(const Int parentIndex);
-	~GameObject();
-
-	bool mDestroyMe;
-	Float mDeltaTime;
-	Int mParentIndex = std::numeric_limits<Int>::min();
-
-	Object3D* mManipulator;
-	std::vector<std::shared_ptr<BaseDrawable>> mDrawables;
-	std::unordered_map<Int, std::shared_ptr<Audio::Playable3D>> mPlayables;
-
-	Vector3 mPosition;
-	Range3D mBbox;
-
-	virtual const Int getType() const = 0;
-	virtual void update() = 0;
-
-	const void playSfxAudio(const Int index, const Float offset = 0.0f);
-	const void pushToFront();
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <unordered_set>
+
+#include <Corrade/Containers/Optional.h>
+#include <Magnum/Audio/Audio.h>
+#include <Magnum/Audio/Buffer.h>
+#include <Magnum/Audio/Playable.h>
+#include <Magnum/Audio/Source.h>
+#include <Magnum/Trade/MeshData.h>
+#include <Magnum/Math/Matrix4.h>
+#include <Magnum/Math/Range.h>
+#include <Magnum/SceneGraph/Camera.h>
+#include <Magnum/SceneGraph/Drawable.h>
+#include <Magnum/SceneGraph/MatrixTransformation3D.h>
+#include <Magnum/SceneGraph/Scene.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/ObjectList.h"
+#include "Graphics/BaseDrawable.h"
+
+using namespace Magnum;
+
+// Reference to a game object of a layer, which doesn't keep it alive
+typedef ObjectHandle GameObjectHandle;
+
+class GameObject : public IDrawCallback
+{
+public:
+	GameObject();
+	GameObject(const Int parentIndex);
+	~GameObject();
+
+	bool mDestroyMe;
+	Float mDeltaTime;
+	Int mParentIndex = std::numeric_limits<Int>::min();
+	GameObjectHandle mHandle = GameObjectHandle{ -1, 0U, 0U };
+
+	Object3D* mManipulator;
+	std::vector<std::shared_ptr<BaseDrawable>> mDrawables;
+	std::unordered_map<Int, std::shared_ptr<Audio::Playable3D>> mPlayables;
+
+	Vector3 mPosition;
+	Range3D mBbox;
+
+	// Position before the last update step, set by the engine, or nothing if never updated
+	Containers::Optional<Vector3> mPreviousPosition;
+
+	virtual const Int getType() const = 0;
+	virtual void update() = 0;
+
+	const void playSfxAudio(const Int index, const Float offset = 0.0f);
+	const void pushToFront();
+
+protected:
+	/*
+		Drawables follow the position of the last update step. Moving objects
+		draw with this instead, to show where they are between the last two
+		steps at the time of the frame, so their motion stays smooth when the
+		frame rate is not a multiple of the update rate.
+	*/
+	const Matrix4 getInterpolatedTransformation(const Matrix4 & transformationMatrix, SceneGraph::Camera3D & camera) const;
 };
\ No newline at end of file
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "Core/ObjectList.h"
+#include "GameObject.h"
+
+// Game objects of a layer, see ObjectList
+typedef ObjectList<GameObject> GameObjectList;
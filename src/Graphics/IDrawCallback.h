@@ -1,9 +1,9 @@
-#pragma once
-
-class BaseDrawable;
-
-class IDrawCallback
-{
-public:
-	virtual void draw(BaseDrawable* drawable, const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) = 0;
+#pragma once
+
+class BaseDrawable;
+
+class IDrawCallback
+{
+public:
+	virtual void draw(BaseDrawable* drawable, const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) = 0;
 };
\ No newline at end of file
@@ -1,7 +1,7 @@
-#pragma once
-
-class IDrawDetached
-{
-public:
-	virtual void drawDetached() = 0;
+#pragma once
+
+class IDrawDetached
+{
+public:
+	virtual void drawDetached() = 0;
 };
\ No newline at end of file
@@ -0,0 +1,258 @@
+#include "InputReplay.h"
+
+#include <cstring>
+#include <iterator>
+
+#include "InputManager.h"
+#include "RandomManager.h"
+
+InputReplay::InputReplay(const Mode mode, const std::string & filename) : mMode(mode), mStep(0), mLastEventStep(0), mCursor(0), mNextEventStep(0), mMousePosition(0, 0), mClickedObjectId(0U)
+{
+	if (mMode == Mode::Record)
+	{
+		mOutput.open(filename, std::ios::binary | std::ios::trunc);
+		if (!mOutput.is_open())
+		{
+			Error{} << "Could not open replay file" << filename << "for writing";
+			return;
+		}
+
+		// Header
+		const UnsignedLong seed = RandomManager::singleton->getBaseSeed();
+		mBuffer.insert(mBuffer.end(), INPUT_REPLAY_MAGIC, INPUT_REPLAY_MAGIC + 4);
+		mBuffer.push_back(UnsignedByte(INPUT_REPLAY_VERSION));
+		for (Int i = 0; i < 8; ++i)
+		{
+			mBuffer.push_back(UnsignedByte(seed >> (i * 8)));
+		}
+		flush();
+
+		Debug{} << "Recording input replay to" << filename;
+	}
+	else
+	{
+		std::ifstream input(filename, std::ios::binary);
+		mInput.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+
+		if (mInput.size() < 13 || std::memcmp(mInput.data(), INPUT_REPLAY_MAGIC, 4) != 0 || mInput[4] != INPUT_REPLAY_VERSION)
+		{
+			Error{} << "Replay file" << filename << "is not valid";
+			mInput.clear();
+			return;
+		}
+
+		// Re-create the same random sequences of the recorded session
+		UnsignedLong seed = 0;
+		for (Int i = 0; i < 8; ++i)
+		{
+			seed |= UnsignedLong(mInput[5 + i]) << (i * 8);
+		}
+		RandomManager::singleton->seedBase(seed);
+
+		mCursor = 13;
+		if (mCursor < mInput.size())
+		{
+			mNextEventStep = readVarint();
+		}
+
+		Debug{} << "Playing input replay from" << filename;
+	}
+}
+
+InputReplay::~InputReplay()
+{
+	if (mMode == Mode::Record)
+	{
+		flush();
+	}
+}
+
+const InputReplay::Mode InputReplay::getMode() const
+{
+	return mMode;
+}
+
+void InputReplay::step(InputManager & im)
+{
+	++mStep;
+
+	if (mMode == Mode::Record)
+	{
+		// Store changes only
+		for (const auto& it : im.mPreTickMouseStates)
+		{
+			const auto& ms = mMouseStates.find(Int(it.first));
+			if (ms == mMouseStates.end() || ms->second != it.second)
+			{
+				mMouseStates[Int(it.first)] = it.second;
+				writeEvent(INPUT_REPLAY_EVENT_MOUSE_BUTTON | (it.second ? INPUT_REPLAY_FLAG_PRESSED : 0), UnsignedLong(Int(it.first)));
+			}
+		}
+
+#ifndef CORRADE_TARGET_ANDROID
+		for (const auto& it : im.mPreTickKeyStates)
+		{
+			const auto& ks = mKeyStates.find(Int(it.first));
+			if (ks == mKeyStates.end() || ks->second != it.second)
+			{
+				mKeyStates[Int(it.first)] = it.second;
+				writeEvent(INPUT_REPLAY_EVENT_KEY | (it.second ? INPUT_REPLAY_FLAG_PRESSED : 0), UnsignedLong(UnsignedInt(it.first)));
+			}
+		}
+#endif
+
+		if (im.mMousePosition != mMousePosition)
+		{
+			writeEvent(INPUT_REPLAY_EVENT_POSITION, zigZag(im.mMousePosition.x() - mMousePosition.x()));
+			writeVarint(zigZag(im.mMousePosition.y() - mMousePosition.y()));
+			mMousePosition = im.mMousePosition;
+		}
+
+		if (im.mClickedObjectId != mClickedObjectId)
+		{
+			writeEvent(INPUT_REPLAY_EVENT_OBJECT_ID, im.mClickedObjectId);
+			mClickedObjectId = im.mClickedObjectId;
+		}
+
+		if (mStep % INPUT_REPLAY_FLUSH_STEPS == 0)
+		{
+			flush();
+		}
+	}
+	else
+	{
+		// Apply all the events recorded for this step
+		while (mCursor < mInput.size() && mNextEventStep <= mStep)
+		{
+			const UnsignedByte type = mInput[mCursor++];
+			const bool pressed = (type & INPUT_REPLAY_FLAG_PRESSED) != 0;
+
+			switch (type & ~INPUT_REPLAY_FLAG_PRESSED)
+			{
+			case INPUT_REPLAY_EVENT_MOUSE_BUTTON:
+				mMouseStates[Int(readVarint())] = pressed;
+				break;
+
+			case INPUT_REPLAY_EVENT_KEY:
+				mKeyStates[Int(UnsignedInt(readVarint()))] = pressed;
+				break;
+
+			case INPUT_REPLAY_EVENT_POSITION:
+				mMousePosition.x() += unZigZag(readVarint());
+				mMousePosition.y() += unZigZag(readVarint());
+				break;
+
+			case INPUT_REPLAY_EVENT_OBJECT_ID:
+				mClickedObjectId = UnsignedInt(readVarint());
+				break;
+
+			case INPUT_REPLAY_EVENT_LEVEL:
+				mExpectedLevels.push_back(UnsignedInt(readVarint()));
+				break;
+
+			default:
+				Error{} << "Unknown replay event" << type << "at step" << mStep << ", stopping playback";
+				mCursor = mInput.size();
+				break;
+			}
+
+			if (mCursor < mInput.size())
+			{
+				mNextEventStep += readVarint();
+			}
+		}
+
+		// Live input is ignored, the recorded one replaces it entirely
+		im.mPreTickMouseStates.clear();
+		for (const auto& it : mMouseStates)
+		{
+			im.mPreTickMouseStates[ImMouseButtons(it.first)] = it.second;
+		}
+
+#ifndef CORRADE_TARGET_ANDROID
+		im.mPreTickKeyStates.clear();
+		for (const auto& it : mKeyStates)
+		{
+			im.mPreTickKeyStates[ImKeyButtons(it.first)] = it.second;
+		}
+#endif
+
+		im.mMousePosition = mMousePosition;
+		im.mClickedObjectId = mClickedObjectId;
+	}
+}
+
+void InputReplay::markLevel(const UnsignedInt seed)
+{
+	if (mMode == Mode::Record)
+	{
+		writeEvent(INPUT_REPLAY_EVENT_LEVEL, seed);
+		flush();
+	}
+	else if (mExpectedLevels.empty())
+	{
+		Warning{} << "Replay diverged at step" << mStep << ": level with seed" << seed << "was not recorded here";
+	}
+	else
+	{
+		if (mExpectedLevels.front() != seed)
+		{
+			Warning{} << "Replay diverged at step" << mStep << ": expected level seed" << mExpectedLevels.front() << "but got" << seed;
+		}
+		mExpectedLevels.erase(mExpectedLevels.begin());
+	}
+}
+
+void InputReplay::writeEvent(const UnsignedByte type, const UnsignedLong value)
+{
+	writeVarint(mStep - mLastEventStep);
+	mBuffer.push_back(type);
+	writeVarint(value);
+	mLastEventStep = mStep;
+}
+
+void InputReplay::writeVarint(UnsignedLong value)
+{
+	while (value >= 0x80)
+	{
+		mBuffer.push_back(UnsignedByte(value | 0x80));
+		value >>= 7;
+	}
+	mBuffer.push_back(UnsignedByte(value));
+}
+
+const UnsignedLong InputReplay::readVarint()
+{
+	UnsignedLong value = 0;
+	for (Int shift = 0; mCursor < mInput.size() && shift < 64; shift += 7)
+	{
+		const UnsignedByte b = mInput[mCursor++];
+		value |= UnsignedLong(b & 0x7f) << shift;
+		if (!(b & 0x80))
+		{
+			break;
+		}
+	}
+	return value;
+}
+
+void InputReplay::flush()
+{
+	if (mOutput.is_open() && !mBuffer.empty())
+	{
+		mOutput.write(reinterpret_cast<const char*>(mBuffer.data()), std::streamsize(mBuffer.size()));
+		mOutput.flush();
+		mBuffer.clear();
+	}
+}
+
+const UnsignedLong InputReplay::zigZag(const Int value)
+{
+	return UnsignedLong(UnsignedInt((value << 1) ^ (value >> 31)));
+}
+
+const Int InputReplay::unZigZag(const UnsignedLong value)
+{
+	const UnsignedInt v = UnsignedInt(value);
+	return Int(v >> 1) ^ -Int(v & 1);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#define INPUT_REPLAY_ENV_RECORD "BMC_REPLAY_RECORD"
+#define INPUT_REPLAY_ENV_PLAYBACK "BMC_REPLAY_PLAYBACK"
+
+#define INPUT_REPLAY_MAGIC "BMCR"
+#define INPUT_REPLAY_VERSION 1
+#define INPUT_REPLAY_FLUSH_STEPS 256
+
+#define INPUT_REPLAY_EVENT_MOUSE_BUTTON 0
+#define INPUT_REPLAY_EVENT_KEY 1
+#define INPUT_REPLAY_EVENT_POSITION 2
+#define INPUT_REPLAY_EVENT_OBJECT_ID 3
+#define INPUT_REPLAY_EVENT_LEVEL 4
+#define INPUT_REPLAY_FLAG_PRESSED 0x10
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <unordered_map>
+#include <Magnum/Magnum.h>
+#include <Magnum/Math/Vector2.h>
+
+#include "Common/CommonTypes.h"
+
+using namespace Magnum;
+
+class InputManager;
+
+/*
+	Records the input seen by every simulation step, or plays it back.
+
+	The log starts with a header (magic, version, base seed of the random
+	streams), followed by events. Every event is made of the number of
+	steps since the previous event (varint), a type byte and its payload
+	(varints, zig-zag encoded for signed values). Only changes are stored,
+	so a typical event takes three or four bytes.
+*/
+class InputReplay
+{
+public:
+	enum class Mode
+	{
+		Record,
+		Playback
+	};
+
+	explicit InputReplay(const Mode mode, const std::string & filename);
+	~InputReplay();
+
+	const Mode getMode() const;
+
+	// Invoked by the input manager at the beginning of every step
+	void step(InputManager & im);
+
+	// Mark the start of a level; on playback, divergences are reported
+	void markLevel(const UnsignedInt seed);
+
+protected:
+	void writeEvent(const UnsignedByte type, const UnsignedLong value);
+	void writeVarint(const UnsignedLong value);
+	const UnsignedLong readVarint();
+	void flush();
+
+	static const UnsignedLong zigZag(const Int value);
+	static const Int unZigZag(const UnsignedLong value);
+
+	Mode mMode;
+	UnsignedLong mStep;
+	UnsignedLong mLastEventStep;
+
+	// Recording
+	std::ofstream mOutput;
+	std::vector<UnsignedByte> mBuffer;
+
+	// Playback
+	std::vector<UnsignedByte> mInput;
+	std::size_t mCursor;
+	UnsignedLong mNextEventStep;
+	std::vector<UnsignedInt> mExpectedLevels;
+
+	// Last known input state, compared (record) or applied (playback) on each step
+	std::unordered_map<Int, Int> mMouseStates;
+	std::unordered_map<Int, Int> mKeyStates;
+	Vector2i mMousePosition;
+	UnsignedInt mClickedObjectId;
+};
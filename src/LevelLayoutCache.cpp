@@ -0,0 +1,73 @@
+#include "LevelLayoutCache.h"
+
+LevelLayoutCache::LevelLayoutCache(const UnsignedInt paletteSize, const std::size_t capacity) : mPaletteSize(paletteSize), mCapacity(capacity)
+{
+}
+
+LevelLayoutCache::~LevelLayoutCache()
+{
+	// Don't leave jobs writing into entries nobody will read
+	for (auto& entry : mEntries)
+	{
+		JobSystem::singleton->wait(entry->group);
+	}
+}
+
+void LevelLayoutCache::prefetch(const UnsignedInt levelId)
+{
+	if (find(levelId) != nullptr)
+	{
+		return;
+	}
+
+	const std::shared_ptr<Entry> entry = insert(levelId);
+	const UnsignedInt paletteSize = mPaletteSize;
+
+	JobSystem::singleton->submit(entry->group, [entry, paletteSize]() {
+		entry->layout = LevelLayout::generate(LevelLayout::getParameters(entry->levelId), paletteSize);
+	});
+}
+
+const LevelLayout & LevelLayoutCache::acquire(const UnsignedInt levelId)
+{
+	std::shared_ptr<Entry> entry = find(levelId);
+	if (entry == nullptr)
+	{
+		Debug{} << "Layout of level" << levelId << "was not prefetched, generating it now";
+
+		entry = insert(levelId);
+		entry->layout = LevelLayout::generate(LevelLayout::getParameters(levelId), mPaletteSize);
+	}
+	else
+	{
+		// Usually done already, otherwise the main thread helps with queued jobs
+		JobSystem::singleton->wait(entry->group);
+	}
+
+	return entry->layout;
+}
+
+std::shared_ptr<LevelLayoutCache::Entry> LevelLayoutCache::find(const UnsignedInt levelId)
+{
+	for (auto it = mEntries.begin(); it != mEntries.end(); ++it)
+	{
+		if ((*it)->levelId == levelId)
+		{
+			mEntries.splice(mEntries.begin(), mEntries, it);
+			return mEntries.front();
+		}
+	}
+	return nullptr;
+}
+
+std::shared_ptr<LevelLayoutCache::Entry> LevelLayoutCache::insert(const UnsignedInt levelId)
+{
+	while (mEntries.size() >= mCapacity)
+	{
+		mEntries.pop_back();
+	}
+
+	mEntries.push_front(std::make_shared<Entry>());
+	mEntries.front()->levelId = levelId;
+	return mEntries.front();
+}
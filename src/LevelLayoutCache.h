@@ -0,0 +1,49 @@
+#pragma once
+
+#define LEVEL_LAYOUT_CACHE_CAPACITY 4
+
+#include <list>
+#include <memory>
+#include <Magnum/Magnum.h>
+
+#include "Core/JobSystem.h"
+#include "Core/LevelLayout.h"
+
+using namespace Magnum;
+
+/*
+	Layouts of recently requested levels, generated on the job system. The
+	level selector asks for the levels the player is about to start while
+	the level window is open, so starting one only has to instantiate it.
+	Every method must be called from the main thread.
+*/
+class LevelLayoutCache
+{
+public:
+	explicit LevelLayoutCache(const UnsignedInt paletteSize, const std::size_t capacity = LEVEL_LAYOUT_CACHE_CAPACITY);
+	~LevelLayoutCache();
+
+	// Start generating the layout of the level in background, if not already cached
+	void prefetch(const UnsignedInt levelId);
+
+	// Layout of the level, waiting for its generation or running it now if never requested. Valid until the next call
+	const LevelLayout & acquire(const UnsignedInt levelId);
+
+protected:
+	struct Entry
+	{
+		UnsignedInt levelId;
+		LevelLayout layout;
+		JobSystem::Group group;
+	};
+
+	// Find an entry and move it in front of the list, as the most recently used
+	std::shared_ptr<Entry> find(const UnsignedInt levelId);
+	std::shared_ptr<Entry> insert(const UnsignedInt levelId);
+
+	UnsignedInt mPaletteSize;
+	std::size_t mCapacity;
+
+	// Most recently used first. Jobs hold their entry, so it can be evicted while in progress
+	std::list<std::shared_ptr<Entry>> mEntries;
+};
@@ -0,0 +1,51 @@
+#include "RandomManager.h"
+
+#include <chrono>
+
+std::unique_ptr<RandomManager> RandomManager::singleton = nullptr;
+
+RandomManager::RandomManager()
+{
+	// Menus and effects outside levels do not need to be reproducible
+	seedBase(UnsignedLong(std::chrono::steady_clock::now().time_since_epoch().count()));
+}
+
+void RandomManager::seedBase(const UnsignedLong base)
+{
+	mBaseSeed = base;
+	for (Int i = 0; i < RNG_STREAM_COUNT; ++i)
+	{
+		mStreams[i].seed(getStreamSeed(base, i));
+	}
+}
+
+const UnsignedLong RandomManager::getBaseSeed() const
+{
+	return mBaseSeed;
+}
+
+void RandomManager::seedLevel(const UnsignedInt levelId)
+{
+	mStreams[RNG_STREAM_BOARD].seed(getStreamSeed(levelId, RNG_STREAM_BOARD));
+	mStreams[RNG_STREAM_EFFECTS].seed(getStreamSeed(levelId, RNG_STREAM_EFFECTS));
+}
+
+RandomGenerator& RandomManager::getStream(const Int stream)
+{
+	return mStreams[stream];
+}
+
+UnsignedInt RandomManager::next(const Int stream, const UnsignedInt bound)
+{
+	return mStreams[stream].next(bound);
+}
+
+Float RandomManager::nextFloat(const Int stream)
+{
+	return mStreams[stream].nextFloat();
+}
+
+const UnsignedLong RandomManager::getStreamSeed(const UnsignedLong base, const Int stream)
+{
+	return (base << 8) ^ UnsignedLong(stream + 1);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#define RNG_STREAM_BOARD 0
+#define RNG_STREAM_EFFECTS 1
+#define RNG_STREAM_MENU 2
+#define RNG_STREAM_COUNT 3
+
+#include <array>
+#include <memory>
+#include <Magnum/Magnum.h>
+
+#include "Core/RandomGenerator.h"
+
+using namespace Magnum;
+
+class RandomManager
+{
+public:
+	static std::unique_ptr<RandomManager> singleton;
+
+	/*
+		Streams are independent from each other, so consuming numbers in
+		one of them (e.g.: visual effects) never alters the sequence of
+		another one (e.g.: the colors picked on the board).
+	*/
+	RandomManager();
+
+	// Seed every stream from a single value, which is what a replay needs to store
+	void seedBase(const UnsignedLong base);
+	const UnsignedLong getBaseSeed() const;
+
+	// Make board and effect streams reproducible for the given level
+	void seedLevel(const UnsignedInt levelId);
+
+	RandomGenerator& getStream(const Int stream);
+
+	UnsignedInt next(const Int stream, const UnsignedInt bound);
+	Float nextFloat(const Int stream);
+
+protected:
+	static const UnsignedLong getStreamSeed(const UnsignedLong base, const Int stream);
+
+	std::array<RandomGenerator, RNG_STREAM_COUNT> mStreams;
+	UnsignedLong mBaseSeed;
+};